@@ -26,6 +26,41 @@ static void BM_CalculateGR(benchmark::State &state)
     }
 }
 
+template <SpeciesType speciesType, SpeciesPopulation population>
+static void BM_CalculateGRIncremental(benchmark::State &state)
+{
+    Problem<speciesType, population> problemDef;
+    auto *cfg = problemDef.configuration();
+
+    // Setup the GR module, and perform a full calculation to establish the reference data
+    auto grModule = std::make_unique<GRModule>();
+    grModule->keywords().set("Configurations", std::vector<Configuration *>{cfg});
+    grModule->keywords().set("Incremental", true);
+    double rdfRange = cfg->box()->inscribedSphereRadius();
+    bool upToDate = false;
+    grModule->calculateGR(problemDef.dissolve().processingModuleData(), problemDef.dissolve().worldPool(), cfg,
+                          GRModule::PartialsMethod::CellsMethod, rdfRange, 0.05, upToDate);
+
+    // Move the requested percentage of atoms before each calculation
+    auto stride = std::max(1, int(100 / state.range(0)));
+    auto step = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ++step;
+        for (auto n = step % stride; n < cfg->nAtoms(); n += stride)
+        {
+            cfg->atoms()[n].translateCoordinates(0.1 * (n % 3) - 0.1, 0.05, -0.07);
+            cfg->updateAtomLocation(&cfg->atoms()[n]);
+        }
+        cfg->incrementContentsVersion();
+        state.ResumeTiming();
+
+        grModule->calculateGR(problemDef.dissolve().processingModuleData(), problemDef.dissolve().worldPool(), cfg,
+                              GRModule::PartialsMethod::CellsMethod, rdfRange, 0.05, upToDate);
+    }
+}
+
 BENCHMARK_TEMPLATE(BM_CalculateGR, SpeciesType::Atomic, SpeciesPopulation::Small, GRModule::PartialsMethod::SimpleMethod)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
@@ -44,6 +79,13 @@ BENCHMARK_TEMPLATE(BM_CalculateGR, SpeciesType::Atomic, SpeciesPopulation::Large
 BENCHMARK_TEMPLATE(BM_CalculateGR, SpeciesType::Atomic, SpeciesPopulation::Large, GRModule::PartialsMethod::CellsMethod)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CalculateGRIncremental, SpeciesType::Atomic, SpeciesPopulation::Large)
+    ->Arg(1)
+    ->Arg(5)
+    ->Arg(10)
+    ->Arg(25)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
 } // namespace Benchmarks
 
 BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 
 #include "analyser/siteSelector.h"
 #include "classes/configuration.h"
+#include "classes/configurationSnapshot.h"
 
 SiteSelector::SiteSelector(Configuration *cfg, const std::vector<const SpeciesSite *> &sites)
     : configuration_(cfg), speciesSites_(sites)
@@ -19,5 +20,20 @@ SiteSelector::SiteSelector(Configuration *cfg, const std::vector<const SpeciesSi
     }
 }
 
+SiteSelector::SiteSelector(const ConfigurationSnapshot &snapshot, const std::vector<const SpeciesSite *> &sites)
+    : speciesSites_(sites)
+{
+    auto siteIndex = 0;
+    for (auto *spSite : speciesSites_)
+    {
+        const auto *siteStack = snapshot.siteStack(spSite);
+        if (siteStack == nullptr)
+            continue;
+
+        for (auto n = 0; n < siteStack->nSites(); ++n)
+            sites_.emplace_back(&siteStack->site(n), ++siteIndex);
+    }
+}
+
 // Return vector of selected sites
 const Analyser::SiteVector &SiteSelector::sites() const { return sites_; }
@@ -9,6 +9,7 @@
 
 // Forward Declarations
 class Configuration;
+class ConfigurationSnapshot;
 class SiteStack;
 class Species;
 class SpeciesSite;
@@ -18,6 +19,7 @@ class SiteSelector
 {
     public:
     SiteSelector(Configuration *cfg, const std::vector<const SpeciesSite *> &sites);
+    SiteSelector(const ConfigurationSnapshot &snapshot, const std::vector<const SpeciesSite *> &sites);
 
     private:
     // Target configuration from which to select sites
@@ -190,8 +190,8 @@ bool LineParser::openOutput(std::string_view filename, bool directOutput)
     return result;
 }
 
-// Open existing stream for writing
-bool LineParser::appendOutput(std::string_view filename)
+// Open existing stream for writing, optionally in binary mode
+bool LineParser::appendOutput(std::string_view filename, bool binary)
 {
     auto result = true;
 
@@ -219,7 +219,7 @@ bool LineParser::appendOutput(std::string_view filename)
 
         // Open file for appending
         directOutput_ = true;
-        outputFile_ = new std::ofstream(outputFilename_, std::ios::app);
+        outputFile_ = new std::ofstream(outputFilename_, binary ? std::ios::app | std::ios::binary : std::ios::app);
         if (!outputFile_->is_open())
         {
             closeFiles();
@@ -785,6 +785,61 @@ bool LineParser::readArg(long long int &i)
     return true;
 }
 
+// Write raw bytes to file
+bool LineParser::writeBinary(const char *source, std::streamsize nBytes) const
+{
+    auto result = true;
+
+    // Master handles the writing
+    if ((!processPool_) || processPool_->isMaster())
+    {
+        if (directOutput_ && outputFile_)
+            result = outputFile_->write(source, nBytes).good();
+        else if (!directOutput_ && cachedFile_)
+            result = cachedFile_->write(source, nBytes).good();
+        else
+        {
+            Messenger::print("Unable to writeBinary - destination file is not open.\n");
+            result = false;
+        }
+    }
+
+    // Broadcast result of write
+    if (processPool_ && (!processPool_->broadcast(result)))
+        return false;
+
+    return result;
+}
+
+// Read raw bytes from file
+bool LineParser::readBinary(char *destination, std::streamsize nBytes)
+{
+    auto result = true;
+
+    // Master reads the data
+    if ((!processPool_) || processPool_->isMaster())
+    {
+        if (inputStream() == nullptr)
+        {
+            Messenger::error("No input file open for LineParser::readBinary.\n");
+            result = false;
+        }
+        else
+            result = inputStream()->read(destination, nBytes).gcount() == nBytes;
+    }
+
+    // Broadcast result of read, followed by the data
+    if (processPool_)
+    {
+        if (!processPool_->broadcast(result))
+            return false;
+        if (result && !processPool_->broadcast(destination, static_cast<int>(nBytes), 0))
+            return false;
+    }
+
+    return result;
+}
+
 // Commit cached output stream to actual output file
 bool LineParser::commitCache()
 {
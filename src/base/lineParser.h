@@ -90,8 +90,8 @@ class LineParser
     bool openInputString(std::string_view s);
     // Open new stream for writing
     bool openOutput(std::string_view filename, bool directOutput = true);
-    // Open existing stream for writing
-    bool appendOutput(std::string_view filename);
+    // Open existing stream for writing, optionally in binary mode
+    bool appendOutput(std::string_view filename, bool binary = false);
     // Close file(s)
     void closeFiles();
     // Return whether current file source is good for reading
@@ -206,6 +206,10 @@ class LineParser
     bool readArg(long int &i);
     // Read long long int argument as single line
     bool readArg(long long int &i);
+    // Write raw bytes to file
+    bool writeBinary(const char *source, std::streamsize nBytes) const;
+    // Read raw bytes from file
+    bool readBinary(char *destination, std::streamsize nBytes);
     // Commit cached output stream to actual output file
     bool commitCache();
 
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/lineScanner.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+// Exactly representable powers of ten
+constexpr std::array<double, 23> powersOfTen = {1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,
+                                                1.0e8,  1.0e9,  1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+                                                1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+} // namespace
+
+LineScanner::LineScanner(const char *begin, const char *end) : pos_(begin), end_(end) {}
+
+// Return whether the specified character is a delimiter within a line
+bool LineScanner::isBlank(char c) { return c == ' ' || c == '\t' || c == '\r' || c == ','; }
+
+// Return whether the specified character is a decimal digit
+bool LineScanner::isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Skip delimiters on the current line
+void LineScanner::skipBlanks()
+{
+    while (pos_ < end_ && isBlank(*pos_))
+        ++pos_;
+}
+
+// Return current position
+const char *LineScanner::position() const { return pos_; }
+
+// Return whether the end of the data has been reached
+bool LineScanner::atEnd() const { return pos_ >= end_; }
+
+// Return whether only whitespace remains
+bool LineScanner::onlyWhitespaceRemains() const
+{
+    return std::all_of(pos_, end_, [](const auto c) { return isBlank(c) || c == '\n'; });
+}
+
+// Skip any whitespace, including empty lines
+void LineScanner::skipWhitespace()
+{
+    while (pos_ < end_ && (isBlank(*pos_) || *pos_ == '\n'))
+        ++pos_;
+}
+
+// Move to the start of the next line, returning false if there isn't one
+bool LineScanner::nextLine()
+{
+    auto *eol = static_cast<const char *>(std::memchr(pos_, '\n', end_ - pos_));
+    pos_ = eol ? eol + 1 : end_;
+    return eol != nullptr;
+}
+
+// Skip the specified number of lines, returning false if the data ends first (a final line without a newline counts)
+bool LineScanner::skipLines(std::size_t nLines)
+{
+    for (std::size_t n = 0; n < nLines; ++n)
+    {
+        if (atEnd())
+            return false;
+        nextLine();
+    }
+    return true;
+}
+
+// Skip next field on the current line
+bool LineScanner::skipField()
+{
+    skipBlanks();
+    auto *start = pos_;
+    while (pos_ < end_ && !isBlank(*pos_) && *pos_ != '\n')
+        ++pos_;
+    return pos_ != start;
+}
+
+// Read next field on the current line as a floating point value
+bool LineScanner::readDouble(double &value)
+{
+    skipBlanks();
+    auto *start = pos_;
+
+    auto negative = false;
+    if (pos_ < end_ && (*pos_ == '-' || *pos_ == '+'))
+        negative = *pos_++ == '-';
+
+    // Accumulate significant digits, noting the decimal exponent of the last one retained
+    uint64_t mantissa = 0;
+    auto exponent = 0, nDigits = 0, nSignificant = 0;
+    auto accumulate = [&](char c, bool fractional)
+    {
+        if (nSignificant < 19)
+        {
+            mantissa = mantissa * 10 + (c - '0');
+            if (mantissa != 0)
+                ++nSignificant;
+            if (fractional)
+                --exponent;
+        }
+        else if (!fractional)
+            ++exponent;
+        ++nDigits;
+    };
+    while (pos_ < end_ && isDigit(*pos_))
+        accumulate(*pos_++, false);
+    if (pos_ < end_ && *pos_ == '.')
+    {
+        ++pos_;
+        while (pos_ < end_ && isDigit(*pos_))
+            accumulate(*pos_++, true);
+    }
+    if (nDigits == 0)
+        return false;
+
+    // Exponent (including Fortran-style 'D')
+    auto fortranExponent = false;
+    if (pos_ < end_ && (*pos_ == 'e' || *pos_ == 'E' || *pos_ == 'd' || *pos_ == 'D'))
+    {
+        fortranExponent = *pos_ == 'd' || *pos_ == 'D';
+        ++pos_;
+        auto negativeExponent = false;
+        if (pos_ < end_ && (*pos_ == '-' || *pos_ == '+'))
+            negativeExponent = *pos_++ == '-';
+        if (pos_ == end_ || !isDigit(*pos_))
+            return false;
+        auto e = 0;
+        while (pos_ < end_ && isDigit(*pos_))
+            e = std::min(e * 10 + (*pos_++ - '0'), 100000);
+        exponent += negativeExponent ? -e : e;
+    }
+    if (pos_ < end_ && !isBlank(*pos_) && *pos_ != '\n')
+        return false;
+
+    // The result is correctly rounded if both the mantissa and the power of ten are exactly representable - otherwise
+    // fall back to the standard library (which doesn't understand Fortran-style exponents)
+    if (mantissa < (uint64_t(1) << 53) && std::abs(exponent) < static_cast<int>(powersOfTen.size()))
+    {
+        value = exponent < 0 ? mantissa / powersOfTen[-exponent] : mantissa * powersOfTen[exponent];
+        if (negative)
+            value = -value;
+    }
+    else
+    {
+        std::string field(start, pos_);
+        if (fortranExponent)
+            std::replace_if(field.begin(), field.end(), [](const auto c) { return c == 'd' || c == 'D'; }, 'e');
+        value = std::strtod(field.c_str(), nullptr);
+    }
+
+    return true;
+}
+
+// Read next field on the current line as an integer
+bool LineScanner::readInteger(long int &value)
+{
+    double d;
+    if (!readDouble(d))
+        return false;
+    value = static_cast<long int>(d);
+    return true;
+}
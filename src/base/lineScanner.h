@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <cstddef>
+
+/*
+ * Line Scanner
+ *
+ * Reads whitespace- (or comma-) delimited fields directly from a range of characters, such as a memory-mapped file, without
+ * copying lines. Floating point values are converted exactly where possible, falling back to the standard library otherwise.
+ */
+class LineScanner
+{
+    public:
+    LineScanner(const char *begin, const char *end);
+
+    private:
+    // Current and end positions
+    const char *pos_, *end_;
+
+    private:
+    // Return whether the specified character is a delimiter within a line
+    static bool isBlank(char c);
+    // Return whether the specified character is a decimal digit
+    static bool isDigit(char c);
+    // Skip delimiters on the current line
+    void skipBlanks();
+
+    public:
+    // Return current position
+    const char *position() const;
+    // Return whether the end of the data has been reached
+    bool atEnd() const;
+    // Return whether only whitespace remains
+    bool onlyWhitespaceRemains() const;
+    // Skip any whitespace, including empty lines
+    void skipWhitespace();
+    // Move to the start of the next line, returning false if there isn't one
+    bool nextLine();
+    // Skip the specified number of lines, returning false if the data ends first (a final line without a newline counts)
+    bool skipLines(std::size_t nLines);
+    // Skip next field on the current line
+    bool skipField();
+    // Read next field on the current line as a floating point value
+    bool readDouble(double &value);
+    // Read next field on the current line as an integer
+    bool readInteger(long int &value);
+};
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/mappedFile.h"
+#include "base/messenger.h"
+#include <filesystem>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() { close(); }
+
+// Map specified file, returning whether successful
+bool MappedFile::open(std::string_view filename)
+{
+    close();
+
+    std::error_code error;
+    auto size = std::filesystem::file_size(std::string(filename), error);
+    if (error)
+        return Messenger::error("Failed to determine size of file '{}' for mapping.\n", filename);
+
+    // Empty files cannot be mapped, but are valid
+    if (size == 0)
+    {
+        filename_ = filename;
+        open_ = true;
+        return true;
+    }
+
+#ifdef _WIN32
+    auto fileHandle = CreateFileA(std::string(filename).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return Messenger::error("Failed to open file '{}' for mapping.\n", filename);
+    mappingHandle_ = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(fileHandle);
+    if (!mappingHandle_)
+        return Messenger::error("Failed to map file '{}'.\n", filename);
+    data_ = static_cast<const char *>(MapViewOfFile(mappingHandle_, FILE_MAP_READ, 0, 0, size));
+    if (!data_)
+    {
+        CloseHandle(mappingHandle_);
+        mappingHandle_ = nullptr;
+        return Messenger::error("Failed to map file '{}'.\n", filename);
+    }
+#else
+    auto fd = ::open(std::string(filename).c_str(), O_RDONLY);
+    if (fd == -1)
+        return Messenger::error("Failed to open file '{}' for mapping.\n", filename);
+    auto *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return Messenger::error("Failed to map file '{}'.\n", filename);
+    data_ = static_cast<const char *>(data);
+
+    // Frames are read in order, so let the kernel read ahead
+    madvise(data, size, MADV_SEQUENTIAL);
+#endif
+
+    filename_ = filename;
+    size_ = size;
+    open_ = true;
+
+    return true;
+}
+
+// Unmap current file
+void MappedFile::close()
+{
+    if (data_)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+        CloseHandle(mappingHandle_);
+        mappingHandle_ = nullptr;
+#else
+        munmap(const_cast<char *>(data_), size_);
+#endif
+    }
+
+    filename_.clear();
+    open_ = false;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+// Return whether a file is currently mapped
+bool MappedFile::isOpen() const { return open_; }
+
+// Return filename of mapped file
+std::string_view MappedFile::filename() const { return filename_; }
+
+// Return start of mapped data
+const char *MappedFile::data() const { return data_; }
+
+// Return size of mapped data
+std::size_t MappedFile::size() const { return size_; }
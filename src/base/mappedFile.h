@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-Only Memory-Mapped File
+class MappedFile
+{
+    public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    private:
+    // Filename of mapped file
+    std::string filename_;
+    // Whether a file is currently mapped
+    bool open_{false};
+    // Start of mapped data
+    const char *data_{nullptr};
+    // Size of mapped data
+    std::size_t size_{0};
+#ifdef _WIN32
+    // Native handle of the file mapping object
+    void *mappingHandle_{nullptr};
+#endif
+
+    public:
+    // Map specified file, returning whether successful
+    bool open(std::string_view filename);
+    // Unmap current file
+    void close();
+    // Return whether a file is currently mapped
+    bool isOpen() const;
+    // Return filename of mapped file
+    std::string_view filename() const;
+    // Return start of mapped data
+    const char *data() const;
+    // Return size of mapped data
+    std::size_t size() const;
+};
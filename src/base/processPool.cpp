@@ -6,6 +6,8 @@
 #include "base/sysFunc.h"
 #include "templates/algorithms.h"
 #include <cassert>
+#include <numeric>
+#include <utility>
 
 // Static Members
 int ProcessPool::nWorldProcesses_ = 1;
@@ -1120,27 +1122,9 @@ bool ProcessPool::allSum(std::vector<Vec3<double>> &source, ProcessPool::Communi
 #ifdef PARALLEL
     if (timer)
         timer->get().start();
-    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
-        return true;
-
-    // Construct POD buffers that we can send via MPI
-    std::vector<double> buffer(source.size()), received(source.size());
-    for (auto n = 0; n < 3; ++n)
-    {
-        std::fill(received.begin(), received.end(), 0.0);
-
-        // Copy elements (x, y, or z) to buffer
-        std::transform(source.begin(), source.end(), buffer.begin(), [n](const auto &val) { return val.get(n); });
 
-        // Reduce
-        if (MPI_Allreduce(buffer.data(), received.data(), received.size(), MPI_DOUBLE, MPI_SUM, communicator(commType)) !=
-            MPI_SUCCESS)
-            return false;
-
-        // Put reduced data back into source
-        for (auto &&[rcvd, val] : zip(received, source))
-            val[n] = rcvd;
-    }
+    if (!allSumBegin({source}, commType).wait())
+        return false;
 
     if (timer)
         timer->get().accumulate();
@@ -1373,6 +1357,176 @@ bool ProcessPool::assemble(double *array, int nLocalData, double *rootDest, int
     return true;
 }
 
+// Gather variable-length double data from all processes into the supplied destination, which is resized to fit the
+// concatenated result
+bool ProcessPool::allGather(const std::vector<double> &source, std::vector<double> &destination,
+                            ProcessPool::CommunicatorType commType, OptionalReferenceWrapper<Timer> timer) const
+{
+#ifdef PARALLEL
+    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
+        return true;
+    if (timer)
+        timer->get().start();
+    auto stopTimer = [&timer](bool result)
+    {
+        if (timer)
+            timer->get().accumulate();
+        return result;
+    };
+
+    // Get the amount of data on each process
+    int nProcesses;
+    MPI_Comm_size(communicator(commType), &nProcesses);
+    int nLocalData = source.size();
+    std::vector<int> counts(nProcesses), offsets(nProcesses);
+    if (MPI_Allgather(&nLocalData, 1, MPI_INT, counts.data(), 1, MPI_INT, communicator(commType)) != MPI_SUCCESS)
+        return stopTimer(false);
+    std::exclusive_scan(counts.begin(), counts.end(), offsets.begin(), 0);
+
+    // Gather the data into a single contiguous array on all processes, reusing the existing storage of the destination
+    destination.resize(offsets.back() + counts.back());
+    if (MPI_Allgatherv(source.data(), nLocalData, MPI_DOUBLE, destination.data(), counts.data(), offsets.data(), MPI_DOUBLE,
+                       communicator(commType)) != MPI_SUCCESS)
+        return stopTimer(false);
+
+    return stopTimer(true);
+#else
+    destination = source;
+    return true;
+#endif
+}
+
+// Exchange variable-length double data with the specified partner processes only, receiving into the destination the data sent
+// by each partner
+bool ProcessPool::exchange(const std::vector<int> &partners, const std::vector<std::vector<double>> &source,
+                           std::vector<std::vector<double>> &destination, ProcessPool::CommunicatorType commType,
+                           OptionalReferenceWrapper<Timer> timer) const
+{
+    assert(source.size() == partners.size());
+    destination.resize(partners.size());
+#ifdef PARALLEL
+    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
+        return true;
+    if (timer)
+        timer->get().start();
+    auto stopTimer = [&timer](bool result)
+    {
+        if (timer)
+            timer->get().accumulate();
+        return result;
+    };
+
+    // Exchange the amount of data to send to / receive from each partner
+    const auto nPartners = partners.size();
+    std::vector<int> sendCounts(nPartners), receiveCounts(nPartners);
+    std::vector<MPI_Request> requests(nPartners * 2);
+    for (auto n = 0; n < nPartners; ++n)
+    {
+        sendCounts[n] = source[n].size();
+        if (MPI_Irecv(&receiveCounts[n], 1, MPI_INT, partners[n], 0, communicator(commType), &requests[n]) != MPI_SUCCESS ||
+            MPI_Isend(&sendCounts[n], 1, MPI_INT, partners[n], 0, communicator(commType), &requests[nPartners + n]) !=
+                MPI_SUCCESS)
+            return stopTimer(false);
+    }
+    if (MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE) != MPI_SUCCESS)
+        return stopTimer(false);
+
+    // Exchange the data, reusing the existing storage of the destination
+    for (auto n = 0; n < nPartners; ++n)
+    {
+        destination[n].resize(receiveCounts[n]);
+        if (MPI_Irecv(destination[n].data(), receiveCounts[n], MPI_DOUBLE, partners[n], 0, communicator(commType),
+                      &requests[n]) != MPI_SUCCESS ||
+            MPI_Isend(source[n].data(), sendCounts[n], MPI_DOUBLE, partners[n], 0, communicator(commType),
+                      &requests[nPartners + n]) != MPI_SUCCESS)
+            return stopTimer(false);
+    }
+    if (MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE) != MPI_SUCCESS)
+        return stopTimer(false);
+
+    return stopTimer(true);
+#else
+    std::copy(source.begin(), source.end(), destination.begin());
+    return true;
+#endif
+}
+
+/*
+ * Non-Blocking Reductions
+ */
+
+ProcessPool::VectorSumRequest::~VectorSumRequest() { wait(); }
+
+ProcessPool::VectorSumRequest::VectorSumRequest(VectorSumRequest &&source) noexcept
+    : targets_(std::move(source.targets_)), buffer_(std::move(source.buffer_)),
+      pending_(std::exchange(source.pending_, false)), failed_(source.failed_)
+{
+#ifdef PARALLEL
+    request_ = source.request_;
+#endif
+}
+
+// Wait for the reduction to complete, unpacking the result into the target vectors
+bool ProcessPool::VectorSumRequest::wait(OptionalReferenceWrapper<Timer> timer)
+{
+    if (!pending_)
+        return !failed_;
+    pending_ = false;
+
+#ifdef PARALLEL
+    if (timer)
+        timer->get().start();
+
+    if (MPI_Wait(&request_, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+    {
+        failed_ = true;
+        return false;
+    }
+
+    // Unpack reduced data back into the targets
+    auto it = buffer_.cbegin();
+    for (auto &target : targets_)
+        for (auto &v : target.get())
+        {
+            v.set(it[0], it[1], it[2]);
+            it += 3;
+        }
+
+    if (timer)
+        timer->get().accumulate();
+#endif
+    return true;
+}
+
+// Begin reduction (sum) of vectors of Vec3<double> data to all processes, packed into a single buffer
+ProcessPool::VectorSumRequest
+ProcessPool::allSumBegin(std::initializer_list<std::reference_wrapper<std::vector<Vec3<double>>>> sources,
+                         ProcessPool::CommunicatorType commType) const
+{
+    VectorSumRequest request;
+#ifdef PARALLEL
+    if ((commType == ProcessPool::GroupLeadersCommunicator) && (!groupLeader()))
+        return request;
+
+    // Pack source data into a single POD buffer that we can send via MPI
+    request.targets_.assign(sources.begin(), sources.end());
+    auto nValues = std::accumulate(request.targets_.begin(), request.targets_.end(), std::size_t(0),
+                                   [](const auto acc, const auto &target) { return acc + target.get().size() * 3; });
+    request.buffer_.reserve(nValues);
+    for (const auto &target : request.targets_)
+        for (const auto &v : target.get())
+            request.buffer_.insert(request.buffer_.end(), {v.x, v.y, v.z});
+
+    // Start the reduction
+    if (MPI_Iallreduce(MPI_IN_PLACE, request.buffer_.data(), request.buffer_.size(), MPI_DOUBLE, MPI_SUM,
+                       communicator(commType), &request.request_) != MPI_SUCCESS)
+        request.failed_ = true;
+    else
+        request.pending_ = true;
+#endif
+    return request;
+}
+
 /*
  * Decisions
  */
@@ -3,13 +3,11 @@
 
 #pragma once
 
-// Random number buffer size
-#define RANDBUFFERSIZE 16172
-
 #include "base/processGroup.h"
 #include "base/timer.h"
 #include "templates/optionalRef.h"
 #include "templates/vector3.h"
+#include <functional>
 // Include <mpi.h> only if we are compiling in parallel
 #ifdef PARALLEL
 #include <mpi.h>
@@ -332,6 +330,54 @@ class ProcessPool
     bool assemble(double *array, int nLocalData, double *rootDest, int rootMaxData, int rootRank = 0,
                   ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator,
                   OptionalReferenceWrapper<Timer> timer = std::nullopt) const;
+    // Gather variable-length double data from all processes into the supplied destination, which is resized to fit the
+    // concatenated result
+    bool allGather(const std::vector<double> &source, std::vector<double> &destination,
+                   ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator,
+                   OptionalReferenceWrapper<Timer> timer = std::nullopt) const;
+    // Exchange variable-length double data with the specified partner processes only, receiving into the destination the
+    // data sent by each partner
+    bool exchange(const std::vector<int> &partners, const std::vector<std::vector<double>> &source,
+                  std::vector<std::vector<double>> &destination,
+                  ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator,
+                  OptionalReferenceWrapper<Timer> timer = std::nullopt) const;
+
+    /*
+     * Non-Blocking Reductions
+     */
+    public:
+    // Handle to a non-blocking reduction (sum) of Vec3<double> data
+    class VectorSumRequest
+    {
+        public:
+        VectorSumRequest() = default;
+        ~VectorSumRequest();
+        VectorSumRequest(const VectorSumRequest &) = delete;
+        VectorSumRequest &operator=(const VectorSumRequest &) = delete;
+        VectorSumRequest(VectorSumRequest &&source) noexcept;
+        VectorSumRequest &operator=(VectorSumRequest &&source) = delete;
+
+        private:
+        // Target vectors to receive reduced data
+        std::vector<std::reference_wrapper<std::vector<Vec3<double>>>> targets_;
+        // Packed buffer being reduced
+        std::vector<double> buffer_;
+        // Whether the reduction is in progress, and whether it failed to start
+        bool pending_{false}, failed_{false};
+#ifdef PARALLEL
+        // MPI request handle
+        MPI_Request request_;
+#endif
+
+        public:
+        // Wait for the reduction to complete, unpacking the result into the target vectors
+        bool wait(OptionalReferenceWrapper<Timer> timer = std::nullopt);
+
+        friend class ProcessPool;
+    };
+    // Begin reduction (sum) of vectors of Vec3<double> data to all processes, packed into a single buffer
+    VectorSumRequest allSumBegin(std::initializer_list<std::reference_wrapper<std::vector<Vec3<double>>>> sources,
+                                 ProcessPool::CommunicatorType commType = ProcessPool::PoolProcessesCommunicator) const;
 
     /*
      * Decisions
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/randomStream.h"
+#include "math/mathFunc.h"
+#include <cassert>
+
+RandomStream::RandomStream(uint64_t seed, uint32_t unit, uint32_t task)
+    : key_{uint32_t(seed), uint32_t(seed >> 32)}, counter_{0, unit, task, 0}
+{
+}
+
+RandomStream::RandomStream(const ProcessPool &procPool, ProcessPool::CommunicatorType commType,
+                           OptionalReferenceWrapper<Timer> commsTimer)
+    : RandomStream(agreeSeed(procPool, commsTimer), unit(procPool, commType))
+{
+    processPool_ = &procPool;
+}
+
+RandomStream::RandomStream(const ProcessPool &procPool, ProcessPool::DivisionStrategy strategy,
+                           OptionalReferenceWrapper<Timer> commsTimer)
+    : RandomStream(procPool, communicator(strategy), commsTimer)
+{
+}
+
+// Return unit index for the specified communicator
+uint32_t RandomStream::unit(const ProcessPool &procPool, ProcessPool::CommunicatorType commType)
+{
+    // Processes sharing a communicator must share a unit, while all others must have a different one
+    switch (commType)
+    {
+        case (ProcessPool::GroupProcessesCommunicator):
+            return (uint32_t(commType) << 24) + procPool.groupIndex();
+        case (ProcessPool::NoCommunicator):
+            return (uint32_t(commType) << 24) + procPool.poolRank();
+        default:
+            return uint32_t(commType) << 24;
+    }
+}
+
+// Agree seed over the specified pool
+uint64_t RandomStream::agreeSeed(const ProcessPool &procPool, OptionalReferenceWrapper<Timer> commsTimer)
+{
+    long int seed = 0;
+    if (procPool.isMaster())
+        seed = (long int)(DissolveMath::randomimax()) << 31 | DissolveMath::randomimax();
+    procPool.broadcast(seed, 0, ProcessPool::PoolProcessesCommunicator, commsTimer);
+
+    return seed;
+}
+
+// Return communicator appropriate to the specified strategy
+ProcessPool::CommunicatorType RandomStream::communicator(ProcessPool::DivisionStrategy strategy)
+{
+    switch (strategy)
+    {
+        case (ProcessPool::GroupsStrategy):
+            return ProcessPool::GroupLeadersCommunicator;
+        case (ProcessPool::GroupProcessesStrategy):
+            return ProcessPool::GroupProcessesCommunicator;
+        case (ProcessPool::PoolStrategy):
+            return ProcessPool::PoolProcessesCommunicator;
+        default:
+            return ProcessPool::NoCommunicator;
+    }
+}
+
+// Reset stream for the specified communicator, moving to a new epoch
+void RandomStream::reset(ProcessPool::CommunicatorType commType)
+{
+    // Processes now sharing the stream may have consumed different amounts of it, so start afresh in a new epoch
+    assert(processPool_);
+    counter_ = {0, unit(*processPool_, commType), counter_[2], counter_[3] + 1};
+    blockIndex_ = 4;
+}
+void RandomStream::reset(ProcessPool::DivisionStrategy strategy) { reset(communicator(strategy)); }
+
+// Create new independent stream for a task within this process
+RandomStream RandomStream::createTaskStream()
+{
+    RandomStream taskStream(*this);
+    taskStream.counter_ = {0, counter_[1], ++nTaskStreams_, counter_[3]};
+    taskStream.blockIndex_ = 4;
+    taskStream.nTaskStreams_ = 0;
+
+    return taskStream;
+}
+
+// Fill supplied range with random numbers (0-1, exclusive of 1)
+void RandomStream::fill(double *begin, double *end)
+{
+    // Use up the current block first
+    while (begin != end && blockIndex_ < 4)
+        *begin++ = Philox::toUnitDouble(block_[blockIndex_++]);
+
+    // Generate whole blocks directly into the destination
+    auto nBlocks = (end - begin) / 4;
+    for (auto n = 0; n < nBlocks; ++n)
+    {
+        auto ctr = counter_;
+        ctr[0] += n;
+        auto bits = Philox::generate(ctr, key_);
+        for (auto m = 0; m < 4; ++m)
+            begin[n * 4 + m] = Philox::toUnitDouble(bits[m]);
+    }
+    counter_[0] += nBlocks;
+    begin += nBlocks * 4;
+
+    // Generate any remainder from a new block
+    while (begin != end)
+        *begin++ = random();
+}
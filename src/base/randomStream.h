@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "base/processPool.h"
+#include "math/philox.h"
+#include "templates/optionalRef.h"
+#include <cstdint>
+
+/*
+ * Random Stream
+ *
+ * Reproducible stream of random numbers drawn from a counter-based generator keyed on (seed, unit, task, epoch). Processes
+ * which must see identical numbers (those sharing a communicator) use the same unit, and agree the seed with a single
+ * broadcast on construction - thereafter no communication is required. Independent streams for concurrent tasks within a
+ * process are obtained with createTaskStream().
+ */
+class RandomStream
+{
+    public:
+    RandomStream(uint64_t seed, uint32_t unit = 0, uint32_t task = 0);
+    RandomStream(const ProcessPool &procPool, ProcessPool::CommunicatorType commType,
+                 OptionalReferenceWrapper<Timer> commsTimer = {});
+    RandomStream(const ProcessPool &procPool, ProcessPool::DivisionStrategy strategy,
+                 OptionalReferenceWrapper<Timer> commsTimer = {});
+
+    private:
+    // Process pool in which the stream is operating (if any)
+    const ProcessPool *processPool_{nullptr};
+    // Generator key (from seed)
+    Philox::Key key_;
+    // Generator counter (position, unit, task, epoch)
+    Philox::Counter counter_;
+    // Random bits generated from the last counter
+    Philox::Counter block_;
+    // Index of next unused value in block
+    int blockIndex_{4};
+    // Number of task streams created
+    uint32_t nTaskStreams_{0};
+
+    private:
+    // Return unit index for the specified communicator
+    static uint32_t unit(const ProcessPool &procPool, ProcessPool::CommunicatorType commType);
+    // Agree seed over the specified pool
+    static uint64_t agreeSeed(const ProcessPool &procPool, OptionalReferenceWrapper<Timer> commsTimer);
+    // Return communicator appropriate to the specified strategy
+    static ProcessPool::CommunicatorType communicator(ProcessPool::DivisionStrategy strategy);
+
+    public:
+    // Reset stream for the specified communicator, moving to a new epoch
+    void reset(ProcessPool::CommunicatorType commType);
+    void reset(ProcessPool::DivisionStrategy strategy);
+    // Create new independent stream for a task within this process
+    RandomStream createTaskStream();
+    // Get next random number (0-1, exclusive of 1)
+    double random()
+    {
+        if (blockIndex_ == 4)
+        {
+            block_ = Philox::generate(counter_, key_);
+            ++counter_[0];
+            blockIndex_ = 0;
+        }
+        return Philox::toUnitDouble(block_[blockIndex_++]);
+    }
+    // Get next random number (-1 to +1, exclusive of +1)
+    double randomPlusMinusOne() { return (random() - 0.5) * 2.0; }
+    // Fill supplied range with random numbers (0-1, exclusive of 1)
+    void fill(double *begin, double *end);
+};
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/atomOwnership.h"
+#include "base/processPool.h"
+#include "classes/cell.h"
+#include "classes/configuration.h"
+#include <algorithm>
+
+AtomOwnership::AtomOwnership(const ProcessPool &procPool, const Configuration *cfg, double haloRange)
+    : configuration_(cfg), poolRank_(procPool.poolRank())
+{
+    // Assign contiguous blocks of cells to processes, balancing the number of atoms in each
+    const auto &cells = configuration_->cells();
+    const auto nAtoms = std::max(configuration_->nAtoms(), 1);
+    const auto nProcesses = procPool.nProcesses();
+    cellOwners_.resize(cells.nCells());
+    auto nPreceding = 0;
+    for (auto id = 0; id < cells.nCells(); ++id)
+    {
+        const auto nCellAtoms = cells.cell(id)->nAtoms();
+
+        // Assign the cell according to the position of its central atom in the sequence of all atoms
+        cellOwners_[id] = std::min(int((nPreceding + 0.5 * nCellAtoms) * nProcesses / nAtoms), nProcesses - 1);
+        if (cellOwners_[id] == poolRank_)
+            ownedCells_.push_back(id);
+
+        nPreceding += nCellAtoms;
+    }
+
+    // Determine the other processes owning cells within the halo range of each cell
+    auto deltas = cells.neighbourGridDeltas(haloRange);
+    deltas.emplace_back(0, 0, 0);
+    auto relativeCell = [&cells](int id, const Vec3<int> &delta)
+    {
+        const auto &grid = cells.cell(id)->gridReference();
+        return cells.cell(grid.x + delta.x, grid.y + delta.y, grid.z + delta.z)->index();
+    };
+    haloRanks_.resize(cells.nCells());
+    for (auto id = 0; id < cells.nCells(); ++id)
+    {
+        auto &ranks = haloRanks_[id];
+        for (const auto &delta : deltas)
+        {
+            auto nbr = relativeCell(id, delta);
+            if (cellOwners_[nbr] != poolRank_)
+                ranks.push_back(cellOwners_[nbr]);
+            if (cellOwners_[id] == poolRank_ && cellOwners_[nbr] != poolRank_)
+                haloCells_.push_back(nbr);
+        }
+        std::sort(ranks.begin(), ranks.end());
+        ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    }
+    std::sort(haloCells_.begin(), haloCells_.end());
+    haloCells_.erase(std::unique(haloCells_.begin(), haloCells_.end()), haloCells_.end());
+
+    // Partners are the processes needing positions of atoms in, or moving into, cells adjacent to our own - atoms may move by
+    // at most one cell between exchanges
+    for (auto id : ownedCells_)
+        for (auto x = -1; x <= 1; ++x)
+            for (auto y = -1; y <= 1; ++y)
+                for (auto z = -1; z <= 1; ++z)
+                {
+                    const auto &ranks = haloRanks_[relativeCell(id, {x, y, z})];
+                    partners_.insert(partners_.end(), ranks.begin(), ranks.end());
+                }
+    std::sort(partners_.begin(), partners_.end());
+    partners_.erase(std::unique(partners_.begin(), partners_.end()), partners_.end());
+
+    // Determine initially-owned atoms
+    const auto &atoms = configuration_->atoms();
+    for (auto n = 0; n < atoms.size(); ++n)
+        if (owns(n))
+            ownedAtoms_.push_back(n);
+}
+
+// Set indices of atoms owned by this process
+void AtomOwnership::setOwnedAtoms(std::vector<int> ownedAtoms) { ownedAtoms_ = std::move(ownedAtoms); }
+
+// Return owning pool rank of specified cell
+int AtomOwnership::cellOwner(int cellIndex) const { return cellOwners_[cellIndex]; }
+
+// Return owning pool rank of specified atom, from its current cell location
+int AtomOwnership::owner(int atomIndex) const { return cellOwners_[configuration_->atoms()[atomIndex].cell()->index()]; }
+
+// Return whether this process owns the specified atom
+bool AtomOwnership::owns(int atomIndex) const { return owner(atomIndex) == poolRank_; }
+
+// Return indices of cells owned by this process
+const std::vector<int> &AtomOwnership::ownedCells() const { return ownedCells_; }
+
+// Return indices of cells within the halo range of owned cells, but owned by other processes
+const std::vector<int> &AtomOwnership::haloCells() const { return haloCells_; }
+
+// Return other pool ranks requiring the positions of atoms in the specified cell
+const std::vector<int> &AtomOwnership::haloRanks(int cellIndex) const { return haloRanks_[cellIndex]; }
+
+// Return pool ranks with which atoms and forces are exchanged
+const std::vector<int> &AtomOwnership::partners() const { return partners_; }
+
+// Return index of specified pool rank in the partners vector, or -1 if it is not a partner
+int AtomOwnership::partnerIndex(int poolRank) const
+{
+    auto it = std::lower_bound(partners_.begin(), partners_.end(), poolRank);
+    return it != partners_.end() && *it == poolRank ? it - partners_.begin() : -1;
+}
+
+// Return indices of atoms owned by this process
+const std::vector<int> &AtomOwnership::ownedAtoms() const { return ownedAtoms_; }
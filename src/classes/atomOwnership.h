@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <vector>
+
+// Forward Declarations
+class Configuration;
+class ProcessPool;
+
+/*
+ * Atom Ownership
+ *
+ * Assigns the cells of a Configuration to the processes of a pool as contiguous blocks of cell indices containing similar
+ * numbers of atoms. Each process is solely responsible for the final forces on (and the integration of) the atoms within its
+ * own cells, and needs up-to-date positions only for atoms within the halo range of those cells. Positions and force
+ * contributions are therefore exchanged only with partner processes owning cells nearby.
+ */
+class AtomOwnership
+{
+    public:
+    AtomOwnership(const ProcessPool &procPool, const Configuration *cfg, double haloRange);
+    ~AtomOwnership() = default;
+
+    private:
+    // Target configuration
+    const Configuration *configuration_;
+    // Pool rank of this process
+    int poolRank_;
+    // Owning pool rank of each cell
+    std::vector<int> cellOwners_;
+    // Indices of cells owned by this process
+    std::vector<int> ownedCells_;
+    // Indices of cells within the halo range of owned cells, but owned by other processes
+    std::vector<int> haloCells_;
+    // Other pool ranks owning cells within the halo range of each cell
+    std::vector<std::vector<int>> haloRanks_;
+    // Pool ranks with which atoms and forces are exchanged
+    std::vector<int> partners_;
+    // Indices of atoms owned by this process
+    std::vector<int> ownedAtoms_;
+
+    public:
+    // Set indices of atoms owned by this process
+    void setOwnedAtoms(std::vector<int> ownedAtoms);
+    // Return owning pool rank of specified cell
+    int cellOwner(int cellIndex) const;
+    // Return owning pool rank of specified atom, from its current cell location
+    int owner(int atomIndex) const;
+    // Return whether this process owns the specified atom
+    bool owns(int atomIndex) const;
+    // Return indices of cells owned by this process
+    const std::vector<int> &ownedCells() const;
+    // Return indices of cells within the halo range of owned cells, but owned by other processes
+    const std::vector<int> &haloCells() const;
+    // Return other pool ranks requiring the positions of atoms in the specified cell
+    const std::vector<int> &haloRanks(int cellIndex) const;
+    // Return pool ranks with which atoms and forces are exchanged
+    const std::vector<int> &partners() const;
+    // Return index of specified pool rank in the partners vector, or -1 if it is not a partner
+    int partnerIndex(int poolRank) const;
+    // Return indices of atoms owned by this process
+    const std::vector<int> &ownedAtoms() const;
+};
@@ -3,12 +3,10 @@
 
 #include "classes/cell.h"
 #include "classes/atom.h"
-#include "classes/box.h"
-#include "templates/algorithms.h"
-#include <algorithm>
+#include "classes/cellArray.h"
 
-Cell::Cell(int index, Vec3<int> gridReference, Vec3<double> centre)
-    : gridReference_(gridReference), index_(index), centre_(centre)
+Cell::Cell(int index, Vec3<int> gridReference, Vec3<double> centre, CellArray *cellArray)
+    : gridReference_(gridReference), index_(index), centre_(centre), cellArray_(cellArray)
 {
 }
 
@@ -37,31 +35,27 @@ const Vec3<double> &Cell::centre() const { return centre_; }
  * Contents
  */
 
-// Return vector of contained Atoms
-std::vector<Atom *> &Cell::atoms() { return atoms_; }
-const std::vector<Atom *> &Cell::atoms() const { return atoms_; }
+// Return parent CellArray
+CellArray *Cell::cellArray() const { return cellArray_; }
 
-// Return number of Atoms in list
-int Cell::nAtoms() const { return atoms_.size(); }
-
-// Add atom to Cell
-void Cell::addAtom(Atom *atom)
+// Return range of contained Atoms
+CellAtomRange Cell::atoms() const
 {
-    assert(atom);
-    assert(!atom->cell());
+    if (!cellArray_)
+        return {};
 
-    atoms_.push_back(atom);
-    atom->setCell(this);
+    auto *storage = cellArray_->atoms().data();
+    return {storage + atomsBegin_, storage + atomsEnd_};
 }
 
-// Remove Atom from Cell
-void Cell::removeAtom(Atom *atom)
-{
-    auto it = std::find(atoms_.begin(), atoms_.end(), atom);
-    assert(it != atoms_.end());
-    (*it)->setCell(nullptr);
-    atoms_.erase(it);
-}
+// Return number of Atoms in range
+int Cell::nAtoms() const { return atomsEnd_ - atomsBegin_; }
+
+// Return offset of first contained Atom in parent storage
+int Cell::atomsBegin() const { return atomsBegin_; }
+
+// Return offset one past the last contained Atom in parent storage
+int Cell::atomsEnd() const { return atomsEnd_; }
 
-// Clear all atoms from cell
-void Cell::clearAtoms() { atoms_.clear(); }
+// Return number of free storage slots following the contained Atoms
+int Cell::nFreeSlots() const { return slotsEnd_ - atomsEnd_; }
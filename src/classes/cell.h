@@ -5,11 +5,30 @@
 
 #include "classes/atom.h"
 #include "templates/vector3.h"
-#include <set>
 #include <vector>
 
 // Forward Declarations
 class Box;
+class CellArray;
+
+// Contiguous range of Atom pointers contained in a Cell
+class CellAtomRange
+{
+    public:
+    CellAtomRange(Atom *const *begin = nullptr, Atom *const *end = nullptr) : begin_(begin), end_(end) {}
+
+    private:
+    // Range limits
+    Atom *const *begin_;
+    Atom *const *end_;
+
+    public:
+    Atom *const *begin() const { return begin_; }
+    Atom *const *end() const { return end_; }
+    int size() const { return static_cast<int>(end_ - begin_); }
+    bool empty() const { return begin_ == end_; }
+    Atom *operator[](int n) const { return begin_[n]; }
+};
 
 /*
  * Cell Definition
@@ -17,8 +36,11 @@ class Box;
 class Cell
 {
     public:
-    Cell(int index = 0, Vec3<int> gridReference = Vec3<int>(), Vec3<double> centre = Vec3<double>());
+    Cell(int index = 0, Vec3<int> gridReference = Vec3<int>(), Vec3<double> centre = Vec3<double>(),
+         CellArray *cellArray = nullptr);
     ~Cell() = default;
+    // CellArray manages the atom ranges of its cells
+    friend class CellArray;
 
     /*
      * Identity
@@ -45,19 +67,24 @@ class Cell
      * Contents
      */
     private:
-    // Vector of Atoms contained in this Cell
-    std::vector<Atom *> atoms_;
+    // Parent CellArray, holding cell-sorted atom storage
+    CellArray *cellArray_{nullptr};
+    // Range of contained atoms in parent storage
+    int atomsBegin_{0}, atomsEnd_{0};
+    // Offset one past the last storage slot reserved for this cell, beyond the range of contained atoms
+    int slotsEnd_{0};
 
     public:
-    // Return array of contained Atoms
-    std::vector<Atom *> &atoms();
-    const std::vector<Atom *> &atoms() const;
-    // Return number of Atoms in array
+    // Return parent CellArray
+    CellArray *cellArray() const;
+    // Return range of contained Atoms
+    CellAtomRange atoms() const;
+    // Return number of Atoms in range
     int nAtoms() const;
-    // Add atom to Cell
-    void addAtom(Atom *atom);
-    // Remove Atom from Cell
-    void removeAtom(Atom *atom);
-    // Clear all atoms from cell
-    void clearAtoms();
+    // Return offset of first contained Atom in parent storage
+    int atomsBegin() const;
+    // Return offset one past the last contained Atom in parent storage
+    int atomsEnd() const;
+    // Return number of free storage slots following the contained Atoms
+    int nFreeSlots() const;
 };
@@ -2,8 +2,13 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "classes/cellArray.h"
+#include "classes/atom.h"
 #include "classes/box.h"
 #include "classes/cell.h"
+#include "templates/algorithms.h"
+#include <algorithm>
+#include <fmt/format.h>
+#include <stdexcept>
 
 /*
  * Cell Data
@@ -21,13 +26,6 @@ Vec3<double> CellArray::realCellSize() const { return realCellSize_; }
 // Return cell extents out from given central cell
 Vec3<int> CellArray::extents() const { return extents_; }
 
-// Clear all atom pointers from cells
-void CellArray::clearAtoms()
-{
-    for (auto &cell : cells_)
-        cell.clearAtoms();
-}
-
 // Retrieve Cell with (wrapped) grid reference specified
 const Cell *CellArray::cell(int x, int y, int z) const
 {
@@ -172,6 +170,287 @@ Vec3<int> CellArray::mimGridDelta(Vec3<int> delta) const
     return delta;
 }
 
+// Return cell extents out from a central cell required to cover the specified range
+Vec3<int> CellArray::extents(double range) const
+{
+    Matrix3 cellAxes = box_->axes();
+    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
+
+    // Establish a maximal extent in principal directions
+    Vec3<int> ext;
+    Vec3<double> r;
+    for (auto n = 0; n < 3; ++n)
+    {
+        do
+        {
+            r.zero();
+            ++ext[n];
+            r[n] = ext[n];
+            r = cellAxes * r;
+        } while (r[n] < range);
+
+        // If we require a larger number of cells than the box physically has along this direction, reduce it accordingly
+        if ((ext[n] * 2 + 1) > divisions_.get(n))
+            ext[n] = divisions_.get(n) / 2;
+    }
+
+    return ext;
+}
+
+// Return unique grid deltas from a central cell to all other cells within the specified range
+std::vector<Vec3<int>> CellArray::neighbourGridDeltas(double range) const
+{
+    Matrix3 cellAxes = box_->axes();
+    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
+    auto ext = extents(range);
+
+    // Loop over extent integers and construct list of gridReferences within range
+    std::vector<Vec3<int>> neighbourIndices;
+    std::vector<const Cell *> cellNbrs;
+    Vec3<int> i, j;
+    Vec3<double> r;
+    for (auto x = -ext.x; x <= ext.x; ++x)
+    {
+        for (auto y = -ext.y; y <= ext.y; ++y)
+        {
+            for (auto z = -ext.z; z <= ext.z; ++z)
+            {
+                if ((x == 0) && (y == 0) && (z == 0))
+                    continue;
+
+                // Check a nominal central cell at (0,0,0) and this grid reference to see if any pairs of
+                // corners are in range
+                auto close = false;
+                for (auto iCorner = 0; iCorner < 8; ++iCorner)
+                {
+                    // Set integer vertex of corner on 'central' box
+                    i.set(iCorner & 1 ? 1 : 0, iCorner & 2 ? 1 : 0, iCorner & 4 ? 1 : 0);
+
+                    for (auto jCorner = 0; jCorner < 8; ++jCorner)
+                    {
+                        // Set integer vertex of corner on 'other' box
+                        j.set(x + (jCorner & 1 ? 1 : 0), y + (jCorner & 2 ? 1 : 0), z + (jCorner & 4 ? 1 : 0));
+
+                        // Get minimum image of vertex j w.r.t. i
+                        j = mimGridDelta(j - i);
+
+                        r.set(j.x, j.y, j.z);
+                        r = cellAxes * r;
+                        if (r.magnitude() < range)
+                        {
+                            close = true;
+                            break;
+                        }
+                    }
+                    if (close)
+                        break;
+                }
+                if (!close)
+                    continue;
+
+                // Check that the cell is not already in the list by querying the cellNbrs vector
+                auto *nbr = cell(x, y, z);
+                if (std::find(cellNbrs.begin(), cellNbrs.end(), nbr) != cellNbrs.end())
+                    continue;
+                neighbourIndices.emplace_back(x, y, z);
+                cellNbrs.push_back(nbr);
+            }
+        }
+    }
+
+    return neighbourIndices;
+}
+
+/*
+ * Atom Storage
+ */
+
+// Return atom pointers for all cells, sorted by cell index, with free (null) slots following the atoms of each cell
+const std::vector<Atom *> &CellArray::atoms() const { return atoms_; }
+
+// Clear all atom pointers from cells
+void CellArray::clearAtoms()
+{
+    for (auto *i : atoms_)
+        if (i)
+            i->setCell(nullptr);
+    atoms_.clear();
+
+    for (auto &cell : cells_)
+        cell.atomsBegin_ = cell.atomsEnd_ = cell.slotsEnd_ = 0;
+    mirrorStorage();
+}
+
+// Return number of storage slots to reserve for a cell containing the specified number of atoms
+int CellArray::nSlots(int population, int nFree) { return population + std::max(nFree, 2 + population / 4); }
+
+// Lay out storage for the current cell populations, giving each cell fresh free slots (at least the number specified)
+// after its atoms
+void CellArray::redistributeSlots(int nFree)
+{
+    auto nStorage = 0;
+    for (const auto &cell : cells_)
+        nStorage += nSlots(cell.nAtoms(), nFree);
+
+    std::vector<Atom *> storage(nStorage, nullptr);
+    auto offset = 0;
+    for (auto &cell : cells_)
+    {
+        auto population = cell.nAtoms();
+        std::copy(atoms_.begin() + cell.atomsBegin_, atoms_.begin() + cell.atomsEnd_, storage.begin() + offset);
+        cell.atomsBegin_ = offset;
+        cell.atomsEnd_ = offset + population;
+        offset += nSlots(population, nFree);
+        cell.slotsEnd_ = offset;
+    }
+    atoms_.swap(storage);
+    mirrorStorage();
+}
+
+// Store atom in the specified slot of the specified cell
+void CellArray::storeAtom(int slot, Atom *i, Cell *cell)
+{
+    atoms_[slot] = i;
+    i->setCell(cell);
+    coordinates_.setSlot(slot, i, static_cast<int>(i - firstAtom_));
+    coordinates_.setCellRange(cell->index(), cell->atomsBegin_, cell->atomsEnd_);
+}
+
+// Copy data for all atoms into the coordinate block, mirroring the current storage slots
+void CellArray::mirrorStorage()
+{
+    coordinates_.initialise(atoms_.size(), cells_.size());
+    for (const auto &cell : cells_)
+    {
+        for (auto slot = cell.atomsBegin_; slot < cell.atomsEnd_; ++slot)
+            coordinates_.setSlot(slot, atoms_[slot], static_cast<int>(atoms_[slot] - firstAtom_));
+        coordinates_.setCellRange(cell.index(), cell.atomsBegin_, cell.atomsEnd_);
+    }
+}
+
+// Assign all supplied atoms to their containing cells, sorting storage by cell index
+void CellArray::assignAtoms(std::vector<Atom> &atoms)
+{
+    // Determine destination cells and cell populations
+    std::vector<Cell *> destinations(atoms.size());
+    std::vector<int> populations(cells_.size(), 0);
+    std::transform(atoms.begin(), atoms.end(), destinations.begin(), [&](const auto &i) { return cell(i.r()); });
+    for (const auto *destination : destinations)
+        ++populations[destination->index()];
+
+    // Set (initially empty) cell ranges, each followed by the free slots for its atoms
+    auto offset = 0;
+    for (auto &&[targetCell, population] : zip(cells_, populations))
+    {
+        targetCell.atomsBegin_ = offset;
+        targetCell.atomsEnd_ = offset;
+        offset += nSlots(population);
+        targetCell.slotsEnd_ = offset;
+    }
+
+    // Store atoms into their cell ranges
+    atoms_.assign(offset, nullptr);
+    for (auto &&[i, destination] : zip(atoms, destinations))
+    {
+        atoms_[destination->atomsEnd_++] = &i;
+        i.setCell(destination);
+    }
+    firstAtom_ = atoms.data();
+    mirrorStorage();
+}
+
+// Add currently unassigned atom to the specified cell
+void CellArray::addAtom(Atom *i, Cell *destination)
+{
+    assert(i && !i->cell() && destination);
+
+    // Take the first free slot in the destination, laying out storage afresh if there are none left
+    if (destination->atomsEnd_ == destination->slotsEnd_)
+    {
+        if (storageFixed_)
+            throw(std::runtime_error(
+                fmt::format("Cell {} has no free slots, but atom storage is fixed and can't be laid out afresh.\n",
+                            destination->index())));
+        redistributeSlots();
+    }
+    auto slot = destination->atomsEnd_++;
+    storeAtom(slot, i, destination);
+}
+
+// Move atom from its current cell to the specified cell, maintaining sorted storage
+void CellArray::moveAtom(Atom *i, Cell *destination)
+{
+    assert(i && i->cell() && destination);
+
+    // Remove the atom from its source cell by replacing it with the last atom in the cell - the cost depends only on the
+    // populations of the cells involved, not on how far apart they are
+    auto *source = i->cell();
+    auto it = std::find(atoms_.begin() + source->atomsBegin_, atoms_.begin() + source->atomsEnd_, i);
+    assert(it != atoms_.begin() + source->atomsEnd_);
+    auto last = --source->atomsEnd_;
+    *it = atoms_[last];
+    coordinates_.copySlot(last, static_cast<int>(it - atoms_.begin()));
+    atoms_[last] = nullptr;
+    coordinates_.clearSlot(last);
+    coordinates_.setCellRange(source->index(), source->atomsBegin_, source->atomsEnd_);
+    i->setCell(nullptr);
+
+    addAtom(i, destination);
+}
+
+// Update stored coordinates of the specified atom, which must remain within its current cell
+void CellArray::updateCoordinates(const Atom *i)
+{
+    assert(i && i->cell());
+
+    auto *c = i->cell();
+    auto it = std::find(atoms_.begin() + c->atomsBegin_, atoms_.begin() + c->atomsEnd_, i);
+    assert(it != atoms_.begin() + c->atomsEnd_);
+    coordinates_.setCoordinates(static_cast<int>(it - atoms_.begin()), i->r());
+}
+
+// Return structure-of-arrays copy of atom data, mirroring the storage slots
+const CoordinateBlock &CellArray::coordinates() const { return coordinates_; }
+
+// Reserve at least the specified number of free slots in every cell, laying out storage afresh if necessary
+void CellArray::reserveFreeSlots(int nFree)
+{
+    if (std::any_of(cells_.begin(), cells_.end(), [nFree](const auto &cell) { return cell.nFreeSlots() < nFree; }))
+        redistributeSlots(nFree);
+}
+
+// Set whether storage is fixed in place, as is required while cells are being modified concurrently
+void CellArray::setStorageFixed(bool fixed) { storageFixed_ = fixed; }
+
+// Return whether the supplied atom(s) can be moved to the cells containing their current coordinates (and back again)
+// without laying out storage afresh
+bool CellArray::canMoveInPlace(const Atom *i) const
+{
+    auto *destination = cell(i->r());
+    return destination == i->cell() || destination->nFreeSlots() > 0;
+}
+bool CellArray::canMoveInPlace(const std::vector<Atom *> &atoms) const
+{
+    // Departures only ever free slots, so the moves can be made in any order provided that no cell receives more atoms than
+    // it currently has free slots - reverting them afterwards then returns no more atoms to each cell than left it
+    std::vector<std::pair<const Cell *, int>> arrivals;
+    for (const auto *i : atoms)
+    {
+        auto *destination = cell(i->r());
+        if (destination == i->cell())
+            continue;
+
+        auto it =
+            std::find_if(arrivals.begin(), arrivals.end(), [destination](const auto &a) { return a.first == destination; });
+        if (it == arrivals.end())
+            it = arrivals.emplace(arrivals.end(), destination, 0);
+        if (++it->second > destination->nFreeSlots())
+            return false;
+    }
+
+    return true;
+}
+
 /*
  * Cell Neighbour
  */
@@ -347,7 +626,7 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
             fracCentre.z = fractionalCellSize_.z * 0.5;
             for (auto z = 0; z < divisions_.z; ++z)
             {
-                cells_[count] = Cell(count, Vec3<int>(x, y, z), box_->getReal(fracCentre));
+                cells_[count] = Cell(count, Vec3<int>(x, y, z), box_->getReal(fracCentre), this);
                 fracCentre.z += fractionalCellSize_.z;
                 ++count;
             }
@@ -355,6 +634,7 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
         }
         fracCentre.x += fractionalCellSize_.x;
     }
+    mirrorStorage();
 
     // Calculate Cell axes matrix
     axes_ = box_->axes();
@@ -364,82 +644,10 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
     Messenger::print("Creating cell neighbour lists...\n");
 
     // Make a list of integer vectors which we'll then use to pick Cells for the neighbour lists
-    Vec3<double> r;
-    Matrix3 cellAxes = box_->axes();
-    cellAxes.applyScaling(fractionalCellSize_.x, fractionalCellSize_.y, fractionalCellSize_.z);
-    extents_.zero();
-
-    // First, establish a maximal extent in principal directions...
-    for (auto n = 0; n < 3; ++n)
-    {
-        do
-        {
-            r.zero();
-            ++extents_[n];
-            r[n] = extents_[n];
-            r = cellAxes * r;
-        } while (r[n] < pairPotentialRange);
-
-        // If we require a larger number of cells than the box physically has along this direction, reduce it accordingly
-        if ((extents_[n] * 2 + 1) > divisions_[n])
-            extents_[n] = divisions_[n] / 2;
-    }
+    extents_ = extents(pairPotentialRange);
     Messenger::print("Cell extents required to cover PairPotential range are (x,y,z) = ({},{},{}).\n", extents_.x, extents_.y,
                      extents_.z);
-
-    // Now, loop over extent integers and construct list of gridReferences within range
-    std::vector<Vec3<int>> neighbourIndices;
-    std::vector<const Cell *> cellNbrs;
-    Vec3<int> i, j;
-    const Cell *nbr;
-    for (auto x = -extents_.x; x <= extents_.x; ++x)
-    {
-        for (auto y = -extents_.y; y <= extents_.y; ++y)
-        {
-            for (auto z = -extents_.z; z <= extents_.z; ++z)
-            {
-                if ((x == 0) && (y == 0) && (z == 0))
-                    continue;
-
-                // Check a nominal central cell at (0,0,0) and this grid reference to see if any pairs of
-                // corners are in range
-                auto close = false;
-                for (auto iCorner = 0; iCorner < 8; ++iCorner)
-                {
-                    // Set integer vertex of corner on 'central' box
-                    i.set(iCorner & 1 ? 1 : 0, iCorner & 2 ? 1 : 0, iCorner & 4 ? 1 : 0);
-
-                    for (auto jCorner = 0; jCorner < 8; ++jCorner)
-                    {
-                        // Set integer vertex of corner on 'other' box
-                        j.set(x + (jCorner & 1 ? 1 : 0), y + (jCorner & 2 ? 1 : 0), z + (jCorner & 4 ? 1 : 0));
-
-                        // Get minimum image of vertex j w.r.t. i
-                        j = mimGridDelta(j - i);
-
-                        r.set(j.x, j.y, j.z);
-                        r = cellAxes * r;
-                        if (r.magnitude() < pairPotentialRange)
-                        {
-                            close = true;
-                            break;
-                        }
-                    }
-                    if (close)
-                        break;
-                }
-                if (!close)
-                    continue;
-
-                // Check that the cell is not already in the list by querying the cellNbrs vector
-                nbr = cell(x, y, z);
-                if (std::find(cellNbrs.begin(), cellNbrs.end(), nbr) != cellNbrs.end())
-                    continue;
-                neighbourIndices.emplace_back(x, y, z);
-                cellNbrs.push_back(nbr);
-            }
-        }
-    }
+    auto neighbourIndices = neighbourGridDeltas(pairPotentialRange);
     Messenger::print("Added {} Cells to representative neighbour list.\n", neighbourIndices.size());
 
     // Construct neighbour arrays for individual Cells
@@ -468,7 +676,13 @@ bool CellArray::generate(const Box *box, double cellSize, double pairPotentialRa
 }
 
 // Clear Cell arrays
-void CellArray::clear() { cells_.clear(); }
+void CellArray::clear()
+{
+    cells_.clear();
+    atoms_.clear();
+    firstAtom_ = nullptr;
+    coordinates_.clear();
+}
 
 /*
  * Operations
@@ -4,15 +4,26 @@
 #pragma once
 
 #include "classes/cellNeighbour.h"
+#include "classes/coordinateBlock.h"
 #include "math/matrix3.h"
 
 // Forward Declarations
+class Atom;
 class Box;
 class Cell;
 
 // Cell Array
 class CellArray
 {
+    public:
+    CellArray() = default;
+    ~CellArray() = default;
+    // Cells refer back to their parent array, so it may be neither copied nor moved
+    CellArray(const CellArray &) = delete;
+    CellArray(CellArray &&) = delete;
+    CellArray &operator=(const CellArray &) = delete;
+    CellArray &operator=(CellArray &&) = delete;
+
     /*
      * Cell Data
      */
@@ -41,8 +52,6 @@ class CellArray
     Vec3<double> realCellSize() const;
     // Return cell extents out from given central cell
     Vec3<int> extents() const;
-    // Clear all atom pointers from cells
-    void clearAtoms();
     // Retrieve Cell with (wrapped) grid reference specified
     const Cell *cell(int x, int y, int z) const;
     // Retrieve Cell with id specified
@@ -58,6 +67,58 @@ class CellArray
     Vec3<int> mimGridDelta(const Cell *a, const Cell *b) const;
     // Return the minimum image equivalent of the supplied grid delta
     Vec3<int> mimGridDelta(Vec3<int> delta) const;
+    // Return cell extents out from a central cell required to cover the specified range
+    Vec3<int> extents(double range) const;
+    // Return unique grid deltas from a central cell to all other cells within the specified range
+    std::vector<Vec3<int>> neighbourGridDeltas(double range) const;
+
+    /*
+     * Atom Storage
+     */
+    private:
+    // Atom pointers for all cells, sorted by cell index, with free (null) slots following the atoms of each cell
+    std::vector<Atom *> atoms_;
+    // Whether storage is fixed in place, and may not be laid out afresh
+    bool storageFixed_{false};
+    // First of the atoms assigned to cells, from which global indices are determined
+    const Atom *firstAtom_{nullptr};
+    // Structure-of-arrays copy of atom data, mirroring the storage slots
+    CoordinateBlock coordinates_;
+
+    private:
+    // Return number of storage slots to reserve for a cell containing the specified number of atoms
+    static int nSlots(int population, int nFree = 0);
+    // Lay out storage for the current cell populations, giving each cell fresh free slots (at least the number specified)
+    // after its atoms
+    void redistributeSlots(int nFree = 0);
+    // Store atom in the specified slot of the specified cell
+    void storeAtom(int slot, Atom *i, Cell *cell);
+    // Copy data for all atoms into the coordinate block, mirroring the current storage slots
+    void mirrorStorage();
+
+    public:
+    // Return atom pointers for all cells, sorted by cell index, with free (null) slots following the atoms of each cell
+    const std::vector<Atom *> &atoms() const;
+    // Clear all atom pointers from cells
+    void clearAtoms();
+    // Assign all supplied atoms to their containing cells, sorting storage by cell index
+    void assignAtoms(std::vector<Atom> &atoms);
+    // Add currently unassigned atom to the specified cell
+    void addAtom(Atom *i, Cell *destination);
+    // Move atom from its current cell to the specified cell, maintaining sorted storage
+    void moveAtom(Atom *i, Cell *destination);
+    // Update stored coordinates of the specified atom, which must remain within its current cell
+    void updateCoordinates(const Atom *i);
+    // Return structure-of-arrays copy of atom data, mirroring the storage slots
+    const CoordinateBlock &coordinates() const;
+    // Reserve at least the specified number of free slots in every cell, laying out storage afresh if necessary
+    void reserveFreeSlots(int nFree);
+    // Set whether storage is fixed in place, as is required while cells are being modified concurrently
+    void setStorageFixed(bool fixed);
+    // Return whether the supplied atom(s) can be moved to the cells containing their current coordinates (and back again)
+    // without laying out storage afresh
+    bool canMoveInPlace(const Atom *i) const;
+    bool canMoveInPlace(const std::vector<Atom *> &atoms) const;
 
     /*
      * Cell Neighbours
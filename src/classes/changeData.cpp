@@ -5,6 +5,7 @@
 #include "base/messenger.h"
 #include "classes/atom.h"
 #include "classes/cell.h"
+#include "classes/cellArray.h"
 #include <cassert>
 
 ChangeData::ChangeData() : atom_(nullptr) {}
@@ -44,12 +45,11 @@ void ChangeData::revertPosition()
     // Set stored position
     atom_->setCoordinates(r_);
 
-    // If the cell changed with the move, revert that too
+    // If the cell changed with the move, revert that too - otherwise just restore the stored coordinates in the cell array
     if (cell_ != atom_->cell())
-    {
-        atom_->cell()->removeAtom(atom_);
-        cell_->addAtom(atom_);
-    }
+        cell_->cellArray()->moveAtom(atom_, cell_);
+    else
+        cell_->cellArray()->updateCoordinates(atom_);
 }
 
 // Return whether atom has moved
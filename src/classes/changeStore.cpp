@@ -83,88 +83,53 @@ void ChangeStore::revert(int id)
 // Save Atom changes for broadcast, and reset arrays for new data
 void ChangeStore::storeAndReset()
 {
-    for (auto item = targetAtoms_.begin(); item < targetAtoms_.end(); ++item)
+    for (auto &item : targetAtoms_)
     {
         // Has the position of this Atom been changed (i.e. updated)?
-        if (item->hasMoved())
-        {
-            changes_.push_back(*item);
-            targetAtoms_.erase(item);
-        }
+        if (!item.hasMoved())
+            continue;
+
+        auto r = item.r();
+        changes_.insert(changes_.end(), {double(item.atomArrayIndex()), r.x, r.y, r.z});
     }
 
     // Clear target Atom data
     targetAtoms_.clear();
 }
 
+// Take saved changes from the supplied ChangeStore, leaving it empty
+void ChangeStore::takeChanges(ChangeStore &source)
+{
+    changes_.insert(changes_.end(), source.changes_.begin(), source.changes_.end());
+    source.reset();
+}
+
+// Return number of saved changes
+int ChangeStore::nChanges() const { return changes_.size() / packedChangeSize_; }
+
 // Distribute and apply changes
 bool ChangeStore::distributeAndApply(Configuration *cfg)
 {
 #ifdef PARALLEL
-    // First, get total number of changes across all processes
-    int nTotalChanges = changes_.size();
-    if (!processPool_.allSum(&nTotalChanges, 1))
-        return false;
-
-    Messenger::printVerbose("We think there are {} changes in total to distribute.\n", nTotalChanges);
-
-    // All processes now resize their arrays so they are large enough to hold the total number of changes
-    if (nTotalChanges == 0)
-        return true;
-    x_.clear();
-    x_.resize(nTotalChanges);
-    y_.clear();
-    y_.resize(nTotalChanges);
-    z_.clear();
-    z_.resize(nTotalChanges);
-    indices_.clear();
-    indices_.resize(nTotalChanges);
-
-    // Copy local change data into arrays
-    std::transform(changes_.begin(), changes_.end(), indices_.begin(), [](auto &change) { return change.atomArrayIndex(); });
-    std::transform(changes_.begin(), changes_.end(), x_.begin(), [](auto &change) { return change.r().x; });
-    std::transform(changes_.begin(), changes_.end(), y_.begin(), [](auto &change) { return change.r().y; });
-    std::transform(changes_.begin(), changes_.end(), z_.begin(), [](auto &change) { return change.r().z; });
-
-    // Now, assemble full array of the change data on the master...
-    if (!processPool_.assemble(indices_.data(), changes_.size(), indices_.data(), nTotalChanges))
-        return false;
-    if (!processPool_.assemble(x_.data(), changes_.size(), x_.data(), nTotalChanges))
-        return false;
-    if (!processPool_.assemble(y_.data(), changes_.size(), y_.data(), nTotalChanges))
-        return false;
-    if (!processPool_.assemble(z_.data(), changes_.size(), z_.data(), nTotalChanges))
+    // Gather the packed changes from all processes in a single contiguous block
+    if (!processPool_.allGather(changes_, distributedChanges_, ProcessPool::PoolProcessesCommunicator, commsTimer_))
         return false;
+    changes_.swap(distributedChanges_);
 
-    // ... then broadcast it to the slaves
-    if (!processPool_.broadcast(indices_))
-        return false;
-    if (!processPool_.broadcast(x_))
-        return false;
-    if (!processPool_.broadcast(y_))
-        return false;
-    if (!processPool_.broadcast(z_))
-        return false;
+    Messenger::printVerbose("There are {} changes in total to apply.\n", nChanges());
+#endif
 
     // Apply atom changes
     auto &atoms = cfg->atoms();
-    for (auto n = 0; n < nTotalChanges; ++n)
+    for (auto it = changes_.cbegin(); it != changes_.cend(); it += packedChangeSize_)
     {
-        assert(indices_[n] >= 0 && indices_[n] < cfg->nAtoms());
+        auto index = static_cast<int>(it[0]);
+        assert(index >= 0 && index < cfg->nAtoms());
 
         // Set new coordinates and update cell position
-        atoms[indices_[n]].setCoordinates(x_[n], y_[n], z_[n]);
-        cfg->updateAtomLocation(&atoms[indices_[n]]);
+        atoms[index].setCoordinates(it[1], it[2], it[3]);
+        cfg->updateAtomLocation(&atoms[index]);
     }
-#else
-    // Apply atom changes
-    for (auto &data : changes_)
-    {
-        // Set new coordinates and check cell position (Configuration::updateAtomInCell() will do all this)
-        data.revertPosition();
-        cfg->updateAtomLocation(data.atom());
-    }
-#endif
 
     return true;
 }
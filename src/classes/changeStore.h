@@ -42,12 +42,12 @@ class ChangeStore
      * Change Data
      */
     private:
-    // List of local changes
-    std::vector<ChangeData> changes_;
-    // Coordinate broadcast arrays
-    std::vector<double> x_, y_, z_;
-    // Index broadcast array
-    std::vector<int> indices_;
+    // Number of packed values stored for each change (global atom index followed by new coordinates)
+    static constexpr int packedChangeSize_ = 4;
+    // Packed local changes, ready for distribution
+    std::vector<double> changes_;
+    // Packed changes gathered from all processes (kept to reuse its storage between distributions)
+    std::vector<double> distributedChanges_;
 
     public:
     // Reset ChangeStore, forgetting all changes
@@ -62,6 +62,10 @@ class ChangeStore
     void revert(int id);
     // Save Atom changes for broadcast, and reset arrays for new data
     void storeAndReset();
+    // Take saved changes from the supplied ChangeStore, leaving it empty
+    void takeChanges(ChangeStore &source);
+    // Return number of saved changes
+    int nChanges() const;
 
     /*
      * Parallel Comms
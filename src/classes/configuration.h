@@ -9,7 +9,9 @@
 #include "classes/atomTypeMix.h"
 #include "classes/box.h"
 #include "classes/cellArray.h"
+#include "classes/configurationSnapshot.h"
 #include "classes/molecule.h"
+#include "classes/neighbourList.h"
 #include "classes/siteStack.h"
 #include "generator/generator.h"
 #include "io/import/coordinates.h"
@@ -221,6 +223,10 @@ class Configuration : public Serialisable<const CoreData &>
     /*
      * Upkeep
      */
+    private:
+    // Verlet neighbour list (rebuilt on demand)
+    NeighbourList neighbourList_;
+
     public:
     // Rationalise object relationships between atoms, molecules, and cells
     void updateObjectRelationships();
@@ -232,6 +238,10 @@ class Configuration : public Serialisable<const CoreData &>
     void updateAtomLocations(const std::shared_ptr<Molecule> &mol);
     // Update Cell location of specified Atom indices
     void updateAtomLocations(const std::vector<int> &targetAtoms, int indexOffset);
+    // Return structure-of-arrays coordinate block, mirroring the cell-sorted atom storage
+    const CoordinateBlock &coordinateBlock() const;
+    // Return Verlet neighbour list for the specified cutoff and skin, rebuilding it if necessary
+    const NeighbourList &neighbourList(double cutoff, double skin);
 
     /*
      * Site Stacks
@@ -244,6 +254,23 @@ class Configuration : public Serialisable<const CoreData &>
     // Calculate / retrieve stack of sites for specified SpeciesSite
     const SiteStack *siteStack(const SpeciesSite *site);
 
+    /*
+     * Frame Snapshots
+     */
+    private:
+    // Snapshots of a batch of trajectory frames, the last of which represents the current contents
+    std::vector<ConfigurationSnapshot> snapshots_;
+    // Contents version represented by the last snapshot
+    int snapshotsVersion_{-1};
+
+    public:
+    // Clear frame snapshots
+    void clearSnapshots();
+    // Add snapshot of the current contents as the next frame in the batch
+    void addSnapshot();
+    // Return batch of frame snapshots, or an empty vector if the current contents are not represented by the last one
+    const std::vector<ConfigurationSnapshot> &snapshots();
+
     /*
      * I/O
      */
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/configurationSnapshot.h"
+#include "classes/configuration.h"
+#include "classes/species.h"
+#include <algorithm>
+
+ConfigurationSnapshot::ConfigurationSnapshot(Configuration *cfg)
+{
+    // Copy the box
+    const auto *box = cfg->box();
+    if (box->type() == Box::BoxType::NonPeriodic)
+        box_ = std::make_unique<NonPeriodicBox>(box->axisLength(0));
+    else
+        box_ = Box::generate(box->axisLengths(), box->axisAngles());
+
+    // Generate stacks for all sites of the Species in the configuration
+    for (const auto &[sp, population] : cfg->speciesPopulations())
+        for (const auto &site : sp->sites())
+        {
+            auto &stack = siteStacks_.emplace_back(std::make_unique<SiteStack>());
+            stack->create(cfg, site.get());
+        }
+}
+
+// Return periodic box
+const Box *ConfigurationSnapshot::box() const { return box_.get(); }
+
+// Return stack of sites for specified SpeciesSite (if it exists)
+const SiteStack *ConfigurationSnapshot::siteStack(const SpeciesSite *site) const
+{
+    auto it = std::find_if(siteStacks_.begin(), siteStacks_.end(),
+                           [site](const auto &stack) { return stack->speciesSite() == site; });
+    return it == siteStacks_.end() ? nullptr : it->get();
+}
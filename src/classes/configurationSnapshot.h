@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "classes/box.h"
+#include "classes/siteStack.h"
+#include <memory>
+#include <vector>
+
+// Forward Declarations
+class Configuration;
+class SpeciesSite;
+
+/*
+ * Configuration Snapshot
+ *
+ * Lightweight copy of the state of a Configuration needed for site-based analysis of a single trajectory frame, comprising
+ * the Box and the stacks of all sites of all Species present. Snapshots do not reference the coordinates of the parent
+ * Configuration, and so remain valid (and may be analysed concurrently) once its contents move on to the next frame.
+ */
+class ConfigurationSnapshot
+{
+    public:
+    ConfigurationSnapshot(Configuration *cfg);
+    ~ConfigurationSnapshot() = default;
+    ConfigurationSnapshot(const ConfigurationSnapshot &) = delete;
+    ConfigurationSnapshot &operator=(const ConfigurationSnapshot &) = delete;
+    ConfigurationSnapshot(ConfigurationSnapshot &&) = default;
+    ConfigurationSnapshot &operator=(ConfigurationSnapshot &&) = default;
+
+    private:
+    // Periodic box
+    std::unique_ptr<Box> box_;
+    // Site stacks
+    std::vector<std::unique_ptr<SiteStack>> siteStacks_;
+
+    public:
+    // Return periodic box
+    const Box *box() const;
+    // Return stack of sites for specified SpeciesSite (if it exists)
+    const SiteStack *siteStack(const SpeciesSite *site) const;
+};
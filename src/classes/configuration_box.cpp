@@ -10,6 +10,7 @@
 void Configuration::createBox(const Vec3<double> lengths, const Vec3<double> angles, bool nonPeriodic)
 {
     box_ = nonPeriodic ? std::make_unique<NonPeriodicBox>() : Box::generate(lengths, angles);
+    neighbourList_.clear();
 }
 
 // Create Box definition from axes matrix
@@ -31,6 +32,7 @@ void Configuration::createBox(const Matrix3 axes)
     angles *= DEGRAD;
 
     box_ = Box::generate(lengths, angles);
+    neighbourList_.clear();
 }
 
 // Create Box definition with specified lengths and angles, and initialise cell array
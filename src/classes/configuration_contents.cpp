@@ -20,6 +20,7 @@ void Configuration::empty()
     globalPotentials_.clear();
     targetedPotentials_.clear();
     cells_.clear();
+    neighbourList_.clear();
 
     ++contentsVersion_;
 }
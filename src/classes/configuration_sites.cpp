@@ -27,3 +27,30 @@ const SiteStack *Configuration::siteStack(const SpeciesSite *site)
 
     return it->get();
 }
+
+/*
+ * Frame Snapshots
+ */
+
+// Clear frame snapshots
+void Configuration::clearSnapshots()
+{
+    snapshots_.clear();
+    snapshotsVersion_ = -1;
+}
+
+// Add snapshot of the current contents as the next frame in the batch
+void Configuration::addSnapshot()
+{
+    snapshots_.emplace_back(this);
+    snapshotsVersion_ = contentsVersion_;
+}
+
+// Return batch of frame snapshots, or an empty vector if the current contents are not represented by the last one
+const std::vector<ConfigurationSnapshot> &Configuration::snapshots()
+{
+    if (snapshotsVersion_ != contentsVersion_)
+        clearSnapshots();
+
+    return snapshots_;
+}
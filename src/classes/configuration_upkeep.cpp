@@ -27,13 +27,14 @@ void Configuration::updateAtomLocations(bool clearExistingLocations)
 {
     if (clearExistingLocations)
     {
+        // Fold all atoms into the Box and re-sort them into their cells in a single pass
         for (auto &i : atoms_)
-            i.setCell(nullptr);
-        cells_.clearAtoms();
+            i.setCoordinates(box_->fold(i.r()));
+        cells_.assignAtoms(atoms_);
     }
-
-    for (auto &i : atoms_)
-        updateAtomLocation(&i);
+    else
+        for (auto &i : atoms_)
+            updateAtomLocation(&i);
 }
 
 // Update Cell location of specified Atom
@@ -45,13 +46,16 @@ void Configuration::updateAtomLocation(Atom *i)
     // Determine new Cell position
     auto *cell = cells_.cell(i->r());
 
-    // Need to move?
+    // Need to move? If not, just update the atom's entry in the coordinate block
     if (cell != i->cell())
     {
         if (i->cell())
-            i->cell()->removeAtom(i);
-        cell->addAtom(i);
+            cells_.moveAtom(i, cell);
+        else
+            cells_.addAtom(i, cell);
     }
+    else
+        cells_.updateCoordinates(i);
 }
 
 // Update Cell locations of atoms within the specified Molecule
@@ -67,3 +71,15 @@ void Configuration::updateAtomLocations(const std::vector<int> &targetAtoms, int
     for (const auto i : targetAtoms)
         updateAtomLocation(&atoms_[i + indexOffset]);
 }
+
+// Return structure-of-arrays coordinate block, mirroring the cell-sorted atom storage
+const CoordinateBlock &Configuration::coordinateBlock() const { return cells_.coordinates(); }
+
+// Return Verlet neighbour list for the specified cutoff and skin, rebuilding it if necessary
+const NeighbourList &Configuration::neighbourList(double cutoff, double skin)
+{
+    if (neighbourList_.requiresRebuild(atoms_, box_.get(), cutoff, skin, contentsVersion_))
+        neighbourList_.build(atoms_, box_.get(), cells_, coordinateBlock(), cutoff, skin, contentsVersion_);
+
+    return neighbourList_;
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/coordinateBlock.h"
+#include "classes/atom.h"
+#include "classes/molecule.h"
+#include <numeric>
+
+// Clear all data
+void CoordinateBlock::clear()
+{
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    localTypeIndices_.clear();
+    masterTypeIndices_.clear();
+    globalIndices_.clear();
+    atoms_.clear();
+    molecules_.clear();
+    cellRanges_.clear();
+}
+
+/*
+ * Data
+ */
+
+// Initialise for the specified number of slots and cells, with all slots free
+void CoordinateBlock::initialise(int nSlots, int nCells)
+{
+    x_.assign(nSlots, 0.0);
+    y_.assign(nSlots, 0.0);
+    z_.assign(nSlots, 0.0);
+    localTypeIndices_.assign(nSlots, -1);
+    masterTypeIndices_.assign(nSlots, -1);
+    globalIndices_.assign(nSlots, -1);
+    atoms_.assign(nSlots, nullptr);
+    molecules_.assign(nSlots, nullptr);
+    cellRanges_.assign(nCells, {0, 0});
+}
+
+// Store data for the supplied atom in the specified slot
+void CoordinateBlock::setSlot(int slot, const Atom *i, int globalIndex)
+{
+    setCoordinates(slot, i->r());
+    localTypeIndices_[slot] = i->localTypeIndex();
+    masterTypeIndices_[slot] = i->masterTypeIndex();
+    globalIndices_[slot] = globalIndex;
+    atoms_[slot] = i;
+    molecules_[slot] = i->molecule().get();
+}
+
+// Copy data from one slot to another
+void CoordinateBlock::copySlot(int from, int to)
+{
+    x_[to] = x_[from];
+    y_[to] = y_[from];
+    z_[to] = z_[from];
+    localTypeIndices_[to] = localTypeIndices_[from];
+    masterTypeIndices_[to] = masterTypeIndices_[from];
+    globalIndices_[to] = globalIndices_[from];
+    atoms_[to] = atoms_[from];
+    molecules_[to] = molecules_[from];
+}
+
+// Free the specified slot
+void CoordinateBlock::clearSlot(int slot)
+{
+    globalIndices_[slot] = -1;
+    atoms_[slot] = nullptr;
+    molecules_[slot] = nullptr;
+}
+
+// Update coordinates in the specified slot
+void CoordinateBlock::setCoordinates(int slot, const Vec3<double> &r)
+{
+    x_[slot] = r.x;
+    y_[slot] = r.y;
+    z_[slot] = r.z;
+}
+
+// Set slot range occupied by the atoms of the specified cell
+void CoordinateBlock::setCellRange(int cellIndex, int begin, int end) { cellRanges_[cellIndex] = {begin, end}; }
+
+// Return total number of slots in block
+int CoordinateBlock::nSlots() const { return static_cast<int>(x_.size()); }
+
+// Return number of occupied slots in block
+int CoordinateBlock::nAtoms() const
+{
+    return std::accumulate(cellRanges_.begin(), cellRanges_.end(), 0,
+                           [](const auto acc, const auto &range) { return acc + range.second - range.first; });
+}
+
+// Return index of first atom in specified cell
+int CoordinateBlock::cellBegin(int cellIndex) const { return cellRanges_[cellIndex].first; }
+
+// Return index one past the last atom in specified cell
+int CoordinateBlock::cellEnd(int cellIndex) const { return cellRanges_[cellIndex].second; }
+
+// Return coordinate arrays
+const double *CoordinateBlock::x() const { return x_.data(); }
+const double *CoordinateBlock::y() const { return y_.data(); }
+const double *CoordinateBlock::z() const { return z_.data(); }
+
+// Return coordinates of specified atom in block
+Vec3<double> CoordinateBlock::r(int index) const { return {x_[index], y_[index], z_[index]}; }
+
+// Return local AtomType index array
+const int *CoordinateBlock::localTypeIndices() const { return localTypeIndices_.data(); }
+
+// Return master AtomType index array
+const int *CoordinateBlock::masterTypeIndices() const { return masterTypeIndices_.data(); }
+
+// Return global atom index array
+const int *CoordinateBlock::globalIndices() const { return globalIndices_.data(); }
+
+// Return source atom array
+const Atom *const *CoordinateBlock::atoms() const { return atoms_.data(); }
+
+// Return parent molecule array
+const Molecule *const *CoordinateBlock::molecules() const { return molecules_.data(); }
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+#include <utility>
+#include <vector>
+
+// Forward Declarations
+class Atom;
+class Molecule;
+
+// Coordinate Block - structure-of-arrays copy of atom data mirroring the cell-sorted storage slots of a CellArray
+class CoordinateBlock
+{
+    public:
+    CoordinateBlock() = default;
+    ~CoordinateBlock() = default;
+    // Clear all data
+    void clear();
+
+    /*
+     * Data
+     */
+    private:
+    // Coordinate arrays
+    std::vector<double> x_, y_, z_;
+    // Local AtomType indices
+    std::vector<int> localTypeIndices_;
+    // Master AtomType indices
+    std::vector<int> masterTypeIndices_;
+    // Global (Configuration) indices of atoms (-1 for free slots)
+    std::vector<int> globalIndices_;
+    // Source atoms (null for free slots)
+    std::vector<const Atom *> atoms_;
+    // Parent molecules of atoms
+    std::vector<const Molecule *> molecules_;
+    // Slot ranges occupied by the atoms of each cell
+    std::vector<std::pair<int, int>> cellRanges_;
+
+    public:
+    // Initialise for the specified number of slots and cells, with all slots free
+    void initialise(int nSlots, int nCells);
+    // Store data for the supplied atom in the specified slot
+    void setSlot(int slot, const Atom *i, int globalIndex);
+    // Copy data from one slot to another
+    void copySlot(int from, int to);
+    // Free the specified slot
+    void clearSlot(int slot);
+    // Update coordinates in the specified slot
+    void setCoordinates(int slot, const Vec3<double> &r);
+    // Set slot range occupied by the atoms of the specified cell
+    void setCellRange(int cellIndex, int begin, int end);
+    // Return total number of slots in block
+    int nSlots() const;
+    // Return number of occupied slots in block
+    int nAtoms() const;
+    // Return index of first atom in specified cell
+    int cellBegin(int cellIndex) const;
+    // Return index one past the last atom in specified cell
+    int cellEnd(int cellIndex) const;
+    // Return coordinate arrays
+    const double *x() const;
+    const double *y() const;
+    const double *z() const;
+    // Return coordinates of specified atom in block
+    Vec3<double> r(int index) const;
+    // Return local AtomType index array
+    const int *localTypeIndices() const;
+    // Return master AtomType index array
+    const int *masterTypeIndices() const;
+    // Return global atom index array
+    const int *globalIndices() const;
+    // Return source atom array
+    const Atom *const *atoms() const;
+    // Return parent molecule array
+    const Molecule *const *molecules() const;
+};
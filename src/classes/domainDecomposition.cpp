@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/domainDecomposition.h"
+#include "classes/atom.h"
+#include "classes/cell.h"
+#include "classes/cellArray.h"
+#include "classes/configuration.h"
+#include "classes/molecule.h"
+#include <algorithm>
+#include <cassert>
+
+DomainDecomposition::DomainDecomposition(const CellArray &cells, int offset)
+{
+    // Determine the number of slabs we can fit along x while keeping each at least as wide as the cell neighbour extent - we
+    // need an even number so that colours alternate across the periodic boundary, and at least two of each colour for there
+    // to be any benefit
+    auto nGrid = cells.divisions().x;
+    auto extent = std::max(1, cells.extents().x);
+    auto nSlabs = 2 * (nGrid / (2 * extent));
+    if (nSlabs < 4)
+        return;
+
+    // Assign grid indices to slabs, rotating the boundaries by the specified offset
+    nDomains_ = nSlabs;
+    offset = ((offset % nGrid) + nGrid) % nGrid;
+    gridDomains_.resize(nGrid);
+    for (auto x = 0; x < nGrid; ++x)
+        gridDomains_[x] = ((x - offset + nGrid) % nGrid) * nSlabs / nGrid;
+    if (gridDomains_.front() == gridDomains_.back())
+        wrappedDomain_ = gridDomains_.front();
+}
+
+// Return number of domains (zero if the cell array is too small to decompose)
+int DomainDecomposition::nDomains() const { return nDomains_; }
+
+// Return domain index of the specified cell
+int DomainDecomposition::domain(const Cell *cell) const
+{
+    if (gridDomains_.empty() || !cell)
+        return -1;
+
+    return gridDomains_[cell->gridReference().x];
+}
+
+// Return domain index containing all atoms of the specified molecule, or -1 if it spans more than one
+int DomainDecomposition::domain(const Molecule &mol) const
+{
+    if (mol.atoms().empty())
+        return -1;
+
+    auto molDomain = domain(mol.atoms().front()->cell());
+    if (std::any_of(mol.atoms().begin(), mol.atoms().end(), [&](const auto *i) { return domain(i->cell()) != molDomain; }))
+        return -1;
+
+    return molDomain;
+}
+
+// Return indices of domains with the specified colour (0 or 1) which may be modified concurrently
+std::vector<int> DomainDecomposition::concurrentDomains(int colour) const
+{
+    std::vector<int> domains;
+    for (auto n = colour; n < nDomains(); n += 2)
+        if (n != wrappedDomain_)
+            domains.push_back(n);
+
+    return domains;
+}
+
+// Partition target molecules into concurrent domains, returning those which must be treated serially
+std::vector<int> DomainDecomposition::partition(Configuration *cfg, const std::vector<int> &targetMolecules)
+{
+    domainMolecules_.clear();
+    if (nDomains() == 0)
+        return targetMolecules;
+
+    domainMolecules_.resize(nDomains());
+    std::vector<int> serialMolecules;
+    for (auto molId : targetMolecules)
+    {
+        auto molDomain = domain(*cfg->molecule(molId));
+        if (molDomain == -1 || molDomain == wrappedDomain_)
+            serialMolecules.push_back(molId);
+        else
+            domainMolecules_[molDomain].push_back(molId);
+    }
+
+    return serialMolecules;
+}
+
+// Return target molecules assigned to the specified domain
+const std::vector<int> &DomainDecomposition::molecules(int domain) const
+{
+    assert(domain >= 0 && domain < domainMolecules_.size());
+    return domainMolecules_[domain];
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <vector>
+
+// Forward Declarations
+class Cell;
+class CellArray;
+class Configuration;
+class Molecule;
+
+/*
+ * Domain Decomposition
+ *
+ * Divides a CellArray into slabs of whole cells along its slowest-varying (x) grid direction, so that each slab occupies a
+ * contiguous range of cell indices. Slabs are at least as wide as the cell neighbour extent and alternate in colour, so that
+ * all slabs of the same colour may be modified concurrently. The slab boundaries are rotated by the supplied offset, and the
+ * slab spanning the periodic boundary in x (if any) is not available for concurrent modification.
+ *
+ * Moving an atom into a cell with no free storage slots lays out the storage of the whole CellArray afresh, so concurrent
+ * moves between cells must first be checked with CellArray::canMoveInPlace() and rejected if necessary.
+ */
+class DomainDecomposition
+{
+    public:
+    DomainDecomposition(const CellArray &cells, int offset = 0);
+    ~DomainDecomposition() = default;
+
+    private:
+    // Number of domains
+    int nDomains_{0};
+    // Domain index of each x grid index
+    std::vector<int> gridDomains_;
+    // Index of domain spanning the periodic boundary in x, if any
+    int wrappedDomain_{-1};
+    // Target molecule indices in each domain
+    std::vector<std::vector<int>> domainMolecules_;
+
+    public:
+    // Return number of domains (zero if the cell array is too small to decompose)
+    int nDomains() const;
+    // Return domain index of the specified cell
+    int domain(const Cell *cell) const;
+    // Return domain index containing all atoms of the specified molecule, or -1 if it spans more than one
+    int domain(const Molecule &mol) const;
+    // Return indices of domains with the specified colour (0 or 1) which may be modified concurrently
+    std::vector<int> concurrentDomains(int colour) const;
+    // Partition target molecules into concurrent domains, returning those which must be treated serially
+    std::vector<int> partition(Configuration *cfg, const std::vector<int> &targetMolecules);
+    // Return target molecules assigned to the specified domain
+    const std::vector<int> &molecules(int domain) const;
+};
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "classes/box.h"
+#include <array>
+#include <cmath>
+
+/*
+ * Minimum Image Functors
+ *
+ * Each functor captures the geometry of a specific Box type so that minimum image calculations can be inlined into pair
+ * loops rather than dispatched through Box's virtual interface for every pair. Use MinimumImage::dispatch() to select the
+ * correct functor for a Box once, outside of the loop.
+ */
+namespace MinimumImage
+{
+// Wrap fractional component into the range [-0.5,0.5]
+// Rounding to the nearest integer (rather than comparing against +/-0.5) keeps pair loops free of branches so that they
+// can be vectorised, and gives identical results to Box::wrap() for components no more than one Box length away
+inline double wrap(double f) { return f - std::nearbyint(f); }
+
+// No minimum image, for use when both points are known to be within the same image
+class None
+{
+    public:
+    // Leave supplied delta untouched
+    void apply(double &dx, double &dy, double &dz) const {}
+};
+
+// Cubic Box
+class Cubic
+{
+    public:
+    explicit Cubic(const Box &box) : a_(box.axisLength(0)), ra_(1.0 / box.axisLength(0)) {}
+
+    private:
+    // Box length and reciprocal
+    double a_, ra_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        dx = wrap(dx * ra_) * a_;
+        dy = wrap(dy * ra_) * a_;
+        dz = wrap(dz * ra_) * a_;
+    }
+};
+
+// Orthorhombic Box
+class Orthorhombic
+{
+    public:
+    explicit Orthorhombic(const Box &box)
+        : a_(box.axisLength(0)), b_(box.axisLength(1)), c_(box.axisLength(2)), ra_(1.0 / a_), rb_(1.0 / b_), rc_(1.0 / c_)
+    {
+    }
+
+    private:
+    // Box lengths and reciprocals
+    double a_, b_, c_, ra_, rb_, rc_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        dx = wrap(dx * ra_) * a_;
+        dy = wrap(dy * rb_) * b_;
+        dz = wrap(dz * rc_) * c_;
+    }
+};
+
+// Monoclinic (alpha != 90) Box
+class MonoclinicAlpha
+{
+    public:
+    explicit MonoclinicAlpha(const Box &box) : axes_(box.axes().matrix()), inverse_(box.inverseAxes().matrix()) {}
+
+    private:
+    // Axes and inverse axes (column-major)
+    std::array<double, 9> axes_, inverse_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        auto fx = wrap(dx * inverse_[0]);
+        auto fy = wrap(dy * inverse_[4] + dz * inverse_[7]);
+        auto fz = wrap(dz * inverse_[8]);
+        dx = fx * axes_[0];
+        dy = fy * axes_[4] + fz * axes_[7];
+        dz = fz * axes_[8];
+    }
+};
+
+// Monoclinic (beta != 90) Box
+class MonoclinicBeta
+{
+    public:
+    explicit MonoclinicBeta(const Box &box) : axes_(box.axes().matrix()), inverse_(box.inverseAxes().matrix()) {}
+
+    private:
+    // Axes and inverse axes (column-major)
+    std::array<double, 9> axes_, inverse_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        auto fx = wrap(dx * inverse_[0] + dz * inverse_[6]);
+        auto fy = wrap(dy * inverse_[4]);
+        auto fz = wrap(dz * inverse_[8]);
+        dx = fx * axes_[0] + fz * axes_[6];
+        dy = fy * axes_[4];
+        dz = fz * axes_[8];
+    }
+};
+
+// Monoclinic (gamma != 90) Box
+class MonoclinicGamma
+{
+    public:
+    explicit MonoclinicGamma(const Box &box) : axes_(box.axes().matrix()), inverse_(box.inverseAxes().matrix()) {}
+
+    private:
+    // Axes and inverse axes (column-major)
+    std::array<double, 9> axes_, inverse_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        auto fx = wrap(dx * inverse_[0] + dy * inverse_[3]);
+        auto fy = wrap(dy * inverse_[4]);
+        auto fz = wrap(dz * inverse_[8]);
+        dx = fx * axes_[0] + fy * axes_[3];
+        dy = fy * axes_[4];
+        dz = fz * axes_[8];
+    }
+};
+
+// Triclinic Box
+class Triclinic
+{
+    public:
+    explicit Triclinic(const Box &box) : axes_(box.axes().matrix()), inverse_(box.inverseAxes().matrix()) {}
+
+    private:
+    // Axes and inverse axes (column-major)
+    std::array<double, 9> axes_, inverse_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        auto fx = wrap(dx * inverse_[0] + (dy * inverse_[3] + dz * inverse_[6]));
+        auto fy = wrap(dy * inverse_[4] + dz * inverse_[7]);
+        auto fz = wrap(dz * inverse_[8]);
+        dx = fx * axes_[0] + (fy * axes_[3] + fz * axes_[6]);
+        dy = fy * axes_[4] + fz * axes_[7];
+        dz = fz * axes_[8];
+    }
+};
+
+// Any other Box, calling through the virtual interface
+class Generic
+{
+    public:
+    explicit Generic(const Box &box) : box_(box) {}
+
+    private:
+    // Target Box
+    const Box &box_;
+
+    public:
+    // Convert supplied delta into its minimum image equivalent
+    void apply(double &dx, double &dy, double &dz) const
+    {
+        auto v = box_.minimumVector({0.0, 0.0, 0.0}, {dx, dy, dz});
+        dx = v.x;
+        dy = v.y;
+        dz = v.z;
+    }
+};
+
+// Return minimum image vector from r1 to r2 using the supplied functor
+template <class MIM> Vec3<double> vector(const MIM &mim, const Vec3<double> &r1, const Vec3<double> &r2)
+{
+    auto dx = r2.x - r1.x, dy = r2.y - r1.y, dz = r2.z - r1.z;
+    mim.apply(dx, dy, dz);
+    return {dx, dy, dz};
+}
+
+// Return minimum image squared distance from r1 to r2 using the supplied functor
+template <class MIM> double distanceSquared(const MIM &mim, const Vec3<double> &r1, const Vec3<double> &r2)
+{
+    auto dx = r2.x - r1.x, dy = r2.y - r1.y, dz = r2.z - r1.z;
+    mim.apply(dx, dy, dz);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Return minimum image distance from r1 to r2 using the supplied functor
+template <class MIM> double distance(const MIM &mim, const Vec3<double> &r1, const Vec3<double> &r2)
+{
+    return sqrt(distanceSquared(mim, r1, r2));
+}
+
+// Call the supplied function with the minimum image functor appropriate to the Box
+template <class Lambda> auto dispatch(const Box &box, Lambda lambda)
+{
+    switch (box.type())
+    {
+        case (Box::BoxType::Cubic):
+            return lambda(Cubic(box));
+        case (Box::BoxType::Orthorhombic):
+            return lambda(Orthorhombic(box));
+        case (Box::BoxType::MonoclinicAlpha):
+            return lambda(MonoclinicAlpha(box));
+        case (Box::BoxType::MonoclinicBeta):
+            return lambda(MonoclinicBeta(box));
+        case (Box::BoxType::MonoclinicGamma):
+            return lambda(MonoclinicGamma(box));
+        case (Box::BoxType::Triclinic):
+            return lambda(Triclinic(box));
+        default:
+            return lambda(Generic(box));
+    }
+}
+} // namespace MinimumImage
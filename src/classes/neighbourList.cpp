@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/neighbourList.h"
+#include "classes/atom.h"
+#include "classes/box.h"
+#include "classes/cell.h"
+#include "classes/cellArray.h"
+#include "classes/coordinateBlock.h"
+#include "classes/minimumImage.h"
+#include "templates/algorithms.h"
+#include <algorithm>
+#include <numeric>
+
+// Clear all data
+void NeighbourList::clear()
+{
+    owners_.clear();
+    offsets_.clear();
+    neighbours_.clear();
+    referenceCoordinates_.clear();
+    cutoff_ = 0.0;
+    skin_ = 0.0;
+    version_ = -1;
+}
+
+/*
+ * Definition
+ */
+
+// Return interaction cutoff for which the list was built
+double NeighbourList::cutoff() const { return cutoff_; }
+
+// Return skin distance beyond the cutoff
+double NeighbourList::skin() const { return skin_; }
+
+// Return number of times the list has been built
+int NeighbourList::nBuilds() const { return nBuilds_; }
+
+/*
+ * Pairs
+ */
+
+// Return whether the list must be rebuilt for the supplied atoms and parameters
+bool NeighbourList::requiresRebuild(const std::vector<Atom> &atoms, const Box *box, double cutoff, double skin,
+                                    int version) const
+{
+    if (version_ == -1 || version != version_ || atoms.size() != referenceCoordinates_.size() || cutoff > cutoff_ ||
+        skin != skin_)
+        return true;
+
+    // Rebuild once any atom has moved further than half the skin distance since the list was built
+    const auto halfSkinSq = 0.25 * skin_ * skin_;
+    return MinimumImage::dispatch(*box,
+                                  [&](const auto mim)
+                                  {
+                                      for (auto &&[i, rRef] : zip(atoms, referenceCoordinates_))
+                                          if (MinimumImage::distanceSquared(mim, i.r(), rRef) > halfSkinSq)
+                                              return true;
+                                      return false;
+                                  });
+}
+
+// Build list for the supplied atoms, locating candidate pairs through the cell array
+void NeighbourList::build(const std::vector<Atom> &atoms, const Box *box, const CellArray &cells, const CoordinateBlock &coords,
+                          double cutoff, double skin, int version)
+{
+    cutoff_ = cutoff;
+    skin_ = skin;
+    version_ = version;
+    ++nBuilds_;
+
+    const auto rangeSq = (cutoff + skin) * (cutoff + skin);
+    const auto *molecules = coords.molecules();
+    const auto *indices = coords.globalIndices();
+
+    // Store reference coordinates
+    referenceCoordinates_.resize(atoms.size());
+    std::transform(atoms.begin(), atoms.end(), referenceCoordinates_.begin(), [](const auto &i) { return i.r(); });
+
+    // Store owning atoms in cell order, skipping the free slots in the coordinate block
+    std::vector<int> cellOwnerOffsets(cells.nCells() + 1, 0);
+    for (auto id = 0; id < cells.nCells(); ++id)
+        cellOwnerOffsets[id + 1] = cellOwnerOffsets[id] + coords.cellEnd(id) - coords.cellBegin(id);
+    owners_.resize(cellOwnerOffsets.back());
+    for (auto id = 0; id < cells.nCells(); ++id)
+        std::copy(indices + coords.cellBegin(id), indices + coords.cellEnd(id), owners_.begin() + cellOwnerOffsets[id]);
+
+    // Get cell grid deltas covering the cutoff plus skin - these may exceed those of the cell array's own neighbour lists
+    auto gridDeltas = cells.neighbourGridDeltas(cutoff + skin);
+
+    // Determine neighbours of atoms in each cell, considering only cells with a higher index so that each pair is found once
+    std::vector<int> nNeighbours(owners_.size(), 0);
+    std::vector<std::vector<int>> cellNeighbours(cells.nCells());
+    auto cellOperator = [&](const int id)
+    {
+        auto *cell = cells.cell(id);
+        auto &cellNbrs = cellNeighbours[id];
+        cellNbrs.clear();
+
+        // Assemble unique higher-indexed neighbour cells
+        std::vector<int> otherCells;
+        for (const auto &delta : gridDeltas)
+        {
+            auto *nbr = cells.cell(cell->gridReference().x + delta.x, cell->gridReference().y + delta.y,
+                                   cell->gridReference().z + delta.z);
+            if (nbr->index() > id && std::find(otherCells.begin(), otherCells.end(), nbr->index()) == otherCells.end())
+                otherCells.push_back(nbr->index());
+        }
+
+        // Test pairs within the cell, and with each of the neighbour cells
+        MinimumImage::dispatch(*box,
+                               [&](const auto mim)
+                               {
+                                   for (auto i = coords.cellBegin(id); i < coords.cellEnd(id); ++i)
+                                   {
+                                       auto nBefore = cellNbrs.size();
+                                       auto rI = coords.r(i);
+                                       auto testPair = [&](int j)
+                                       {
+                                           if (molecules[i] == molecules[j])
+                                               return;
+                                           if (MinimumImage::distanceSquared(mim, rI, coords.r(j)) <= rangeSq)
+                                               cellNbrs.push_back(indices[j]);
+                                       };
+
+                                       for (auto j = i + 1; j < coords.cellEnd(id); ++j)
+                                           testPair(j);
+                                       for (auto otherCell : otherCells)
+                                           for (auto j = coords.cellBegin(otherCell); j < coords.cellEnd(otherCell); ++j)
+                                               testPair(j);
+
+                                       nNeighbours[cellOwnerOffsets[id] + i - coords.cellBegin(id)] =
+                                           static_cast<int>(cellNbrs.size() - nBefore);
+                                   }
+                               });
+    };
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                       dissolve::counting_iterator<int>(cells.nCells()), cellOperator);
+
+    // Set neighbour offsets and collapse cell neighbour vectors into the main array
+    offsets_.resize(owners_.size() + 1);
+    offsets_[0] = 0;
+    std::partial_sum(nNeighbours.begin(), nNeighbours.end(), offsets_.begin() + 1);
+    neighbours_.resize(offsets_.back());
+    for (auto id = 0; id < cells.nCells(); ++id)
+        std::copy(cellNeighbours[id].begin(), cellNeighbours[id].end(), neighbours_.begin() + offsets_[cellOwnerOffsets[id]]);
+}
+
+// Return number of owning atoms
+int NeighbourList::nOwners() const { return static_cast<int>(owners_.size()); }
+
+// Return global index of specified owning atom
+int NeighbourList::owner(int n) const { return owners_[n]; }
+
+// Return neighbour range for specified owning atom
+const int *NeighbourList::neighboursBegin(int n) const { return neighbours_.data() + offsets_[n]; }
+const int *NeighbourList::neighboursEnd(int n) const { return neighbours_.data() + offsets_[n + 1]; }
+
+// Return total number of pairs in list
+int NeighbourList::nPairs() const { return static_cast<int>(neighbours_.size()); }
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "templates/vector3.h"
+#include <vector>
+
+// Forward Declarations
+class Atom;
+class Box;
+class CellArray;
+class CoordinateBlock;
+
+// Neighbour List - Verlet half list of intermolecular atom pairs within a cutoff plus skin distance
+class NeighbourList
+{
+    public:
+    NeighbourList() = default;
+    ~NeighbourList() = default;
+    // Clear all data
+    void clear();
+
+    /*
+     * Definition
+     */
+    private:
+    // Interaction cutoff for which the list was built
+    double cutoff_{0.0};
+    // Skin distance beyond the cutoff
+    double skin_{0.0};
+    // Contents version at which the list was built
+    int version_{-1};
+    // Number of times the list has been built
+    int nBuilds_{0};
+
+    public:
+    // Return interaction cutoff for which the list was built
+    double cutoff() const;
+    // Return skin distance beyond the cutoff
+    double skin() const;
+    // Return number of times the list has been built
+    int nBuilds() const;
+
+    /*
+     * Pairs
+     */
+    private:
+    // Global indices of owning atoms, in cell order at time of build
+    std::vector<int> owners_;
+    // Offsets of the neighbours of each owning atom, including a final end offset
+    std::vector<int> offsets_;
+    // Global indices of neighbouring atoms
+    std::vector<int> neighbours_;
+    // Atom coordinates at time of build
+    std::vector<Vec3<double>> referenceCoordinates_;
+
+    public:
+    // Return whether the list must be rebuilt for the supplied atoms and parameters
+    bool requiresRebuild(const std::vector<Atom> &atoms, const Box *box, double cutoff, double skin, int version) const;
+    // Build list for the supplied atoms, locating candidate pairs through the cell array
+    void build(const std::vector<Atom> &atoms, const Box *box, const CellArray &cells, const CoordinateBlock &coords,
+               double cutoff, double skin, int version);
+    // Return number of owning atoms
+    int nOwners() const;
+    // Return global index of specified owning atom
+    int owner(int n) const;
+    // Return neighbour range for specified owning atom
+    const int *neighboursBegin(int n) const;
+    const int *neighboursEnd(int n) const;
+    // Return total number of pairs in list
+    int nPairs() const;
+};
@@ -16,19 +16,13 @@ PairPotential::ShortRangeTruncationScheme PairPotential::shortRangeTruncationSch
 bool PairPotential::includeCoulombPotential_ = false;
 
 PairPotential::PairPotential(std::string_view nameI, std::string_view nameJ)
-    : nameI_(nameI), nameJ_(nameJ), totalShortRangePotentialInterpolation_(referenceShortRangePotential_),
-      coulombPotentialInterpolation_(coulombPotential_), totalPotentialInterpolation_(totalPotential_),
-      totalShortRangeDerivativeInterpolation_(totalShortRangeDerivative_), coulombDerivativeInterpolation_(coulombDerivative_),
-      totalDerivativeInterpolation_(totalDerivative_), interactionPotential_{Functions1D::Form::None, ""},
+    : nameI_(nameI), nameJ_(nameJ), interactionPotential_{Functions1D::Form::None, ""},
       potentialFunction_{Functions1D::Form::None, {}}
 {
 }
 
 PairPotential::PairPotential(std::string_view nameI, std::string_view nameJ, const InteractionPotential<Functions1D> &potential)
-    : nameI_(nameI), nameJ_(nameJ), interactionPotential_(potential),
-      totalShortRangePotentialInterpolation_(referenceShortRangePotential_), coulombPotentialInterpolation_(coulombPotential_),
-      totalPotentialInterpolation_(totalPotential_), totalShortRangeDerivativeInterpolation_(totalShortRangeDerivative_),
-      coulombDerivativeInterpolation_(coulombDerivative_), totalDerivativeInterpolation_(totalDerivative_)
+    : nameI_(nameI), nameJ_(nameJ), interactionPotential_(potential)
 {
     potentialFunction_.setFormAndParameters(interactionPotential_.form(), interactionPotential_.parameters());
 }
@@ -179,20 +173,17 @@ void PairPotential::updateTotals()
         total = totalSR + coul;
     }
 
-    // Recalculate interpolations
-    totalShortRangePotentialInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
-    coulombPotentialInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
-    totalPotentialInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
-
     // Calculate derivatives
     totalShortRangeDerivative_ = Derivative::derivative(totalShortRangePotential_);
     coulombDerivative_ = Derivative::derivative(coulombPotential_);
     totalDerivative_ = Derivative::derivative(totalPotential_);
 
-    // Update interpolations for derivatives
-    totalShortRangeDerivativeInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
-    coulombDerivativeInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
-    totalDerivativeInterpolation_.interpolate(Interpolator::ThreePointInterpolation);
+    // Regenerate lookup tables
+    // Note that the short-range energy table is generated from the reference short-range potential only
+    totalShortRangeTable_.generate(referenceShortRangePotential_, totalShortRangeDerivative_, delta_);
+    coulombTable_.generate(coulombPotential_, coulombDerivative_, delta_);
+    totalTable_.generate(totalPotential_, totalDerivative_, delta_);
+    ++tableVersion_;
 }
 
 // Generate energy and force tables
@@ -258,18 +249,17 @@ double PairPotential::range() const { return range_; }
 double PairPotential::delta() const { return delta_; }
 
 // Return potential at specified r
-double PairPotential::energy(double r)
+double PairPotential::energy(double r) const
 {
     assert(r >= 0);
 
-    return totalPotentialInterpolation_.y(r, r * rDelta_);
+    return totalTable_.energy(r);
 }
-double PairPotential::energy(double r, double elecScale, double srScale)
+double PairPotential::energy(double r, double elecScale, double srScale) const
 {
     assert(r >= 0);
 
-    return totalShortRangePotentialInterpolation_.y(r, r * rDelta_) * srScale +
-           coulombPotentialInterpolation_.y(r, r * rDelta_) * elecScale;
+    return totalShortRangeTable_.energy(r) * srScale + coulombTable_.energy(r) * elecScale;
 }
 
 // Return analytic potential at specified r, including Coulomb term from local atomtype charges
@@ -305,18 +295,33 @@ double PairPotential::analyticCoulombEnergy(double qiqj, double r, PairPotential
 }
 
 // Return derivative at specified r
-double PairPotential::force(double r)
+double PairPotential::force(double r) const
+{
+    assert(r >= 0);
+
+    return totalTable_.force(r);
+}
+double PairPotential::force(double r, double elecScale, double srScale) const
+{
+    assert(r >= 0);
+
+    return totalShortRangeTable_.force(r) * srScale + coulombTable_.force(r) * elecScale;
+}
+
+// Return potential and derivative of potential at specified r
+std::pair<double, double> PairPotential::energyAndForce(double r) const
 {
     assert(r >= 0);
 
-    return -totalDerivativeInterpolation_.y(r, r * rDelta_);
+    return totalTable_.energyAndForce(r);
 }
-double PairPotential::force(double r, double elecScale, double srScale)
+std::pair<double, double> PairPotential::energyAndForce(double r, double elecScale, double srScale) const
 {
     assert(r >= 0);
 
-    return -(totalShortRangeDerivativeInterpolation_.y(r, r * rDelta_) * srScale +
-             coulombDerivativeInterpolation_.y(r, r * rDelta_) * elecScale);
+    auto [srEnergy, srForce] = totalShortRangeTable_.energyAndForce(r);
+    auto [elecEnergy, elecForce] = coulombTable_.energyAndForce(r);
+    return {srEnergy * srScale + elecEnergy * elecScale, srForce * srScale + elecForce * elecScale};
 }
 
 // Return analytic force at specified r
@@ -369,6 +374,12 @@ const Data1D &PairPotential::totalPotential() const { return totalPotential_; }
 // Return full tabulated derivative
 const Data1D &PairPotential::derivative() const { return totalDerivative_; }
 
+// Return lookup table for full potential
+const PotentialTable &PairPotential::totalTable() const { return totalTable_; }
+
+// Return version of lookup tables
+int PairPotential::tableVersion() const { return tableVersion_; }
+
 // Return short-range potential
 const Data1D &PairPotential::shortRangePotential() const { return referenceShortRangePotential_; }
 
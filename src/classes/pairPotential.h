@@ -7,6 +7,7 @@
 #include "math/data1D.h"
 #include "math/function1D.h"
 #include "math/interpolator.h"
+#include "math/potentialTable.h"
 #include <memory>
 
 // Forward Declarations
@@ -115,12 +116,12 @@ class PairPotential : Serialisable<>
     Data1D totalShortRangePotential_;
     // Total potential: reference and additional short-range plus Coulomb
     Data1D totalPotential_;
-    // Interpolators for potentials
-    Interpolator totalShortRangePotentialInterpolation_, coulombPotentialInterpolation_, totalPotentialInterpolation_;
     // Tabulated derivative
     Data1D totalDerivative_, totalShortRangeDerivative_, coulombDerivative_;
-    // Interpolators for derivatives
-    Interpolator totalShortRangeDerivativeInterpolation_, coulombDerivativeInterpolation_, totalDerivativeInterpolation_;
+    // Lookup tables for energy and force
+    PotentialTable totalShortRangeTable_, coulombTable_, totalTable_;
+    // Version of lookup tables, incremented whenever they are regenerated
+    int tableVersion_{0};
 
     private:
     // Return analytic short range potential energy
@@ -142,8 +143,8 @@ class PairPotential : Serialisable<>
     // Return spacing between points
     double delta() const;
     // Return potential at specified r
-    double energy(double r);
-    double energy(double r, double elecScale, double srScale);
+    double energy(double r) const;
+    double energy(double r, double elecScale, double srScale) const;
     // Return analytic potential at specified r, including Coulomb term from local charge product
     double analyticEnergy(double r, double elecScale, double srScale) const;
     // Return analytic potential at specified r, including Coulomb term from supplied charge product
@@ -154,8 +155,11 @@ class PairPotential : Serialisable<>
     analyticCoulombEnergy(double qiqj, double r,
                           PairPotential::CoulombTruncationScheme truncation = PairPotential::coulombTruncationScheme()) const;
     // Return derivative of potential at specified r
-    double force(double r);
-    double force(double r, double elecScale, double srScale);
+    double force(double r) const;
+    double force(double r, double elecScale, double srScale) const;
+    // Return potential and derivative of potential at specified r
+    std::pair<double, double> energyAndForce(double r) const;
+    std::pair<double, double> energyAndForce(double r, double elecScale, double srScale) const;
     // Return analytic force at specified r, including Coulomb term from local charge product
     double analyticForce(double r, double elecScale, double srScale) const;
     // Return analytic force at specified r, including Coulomb term from supplied charge product
@@ -169,6 +173,10 @@ class PairPotential : Serialisable<>
     const Data1D &totalPotential() const;
     // Return full tabulated derivative
     const Data1D &derivative() const;
+    // Return lookup table for full potential
+    const PotentialTable &totalTable() const;
+    // Return version of lookup tables
+    int tableVersion() const;
     // Return short range potential
     const Data1D &shortRangePotential() const;
     // Return Coulomb potential
@@ -9,6 +9,7 @@
 #include "io/export/data1D.h"
 #include "items/deserialisers.h"
 #include "items/serialisers.h"
+#include "math/ft.h"
 #include "templates/algorithms.h"
 
 PartialSet::PartialSet() { fingerprint_ = "NO_FINGERPRINT"; }
@@ -374,6 +375,69 @@ void PartialSet::calculateRDF(Data1D &destination, const Histogram1D &histogram,
     }
 }
 
+// Set partials from the Fourier sine transforms of those in the source PartialSet, subtracting the specified offset from the
+// full and unbound source partials beforehand
+bool PartialSet::sineFT(const PartialSet &source, double normFactor, double wMin, double wStep, double wMax,
+                        const WindowFunction &windowFunction, const Function1DWrapper &broadening, double offset)
+{
+    if (source.nAtomTypes() != nAtomTypes())
+        return Messenger::error("PartialSet::sineFT - sizes of source and destination partial sets are different.\n");
+
+    // Gather all source partials and their destinations, noting which are to be offset
+    struct Transform
+    {
+        const Data1D *source;
+        Data1D *destination;
+        bool offset;
+    };
+    std::vector<Transform> remaining;
+    for (auto n = 0; n < partials_.size(); ++n)
+    {
+        remaining.push_back({&source.partials_.linearArray()[n], &partials_.linearArray()[n], true});
+        remaining.push_back({&source.boundPartials_.linearArray()[n], &boundPartials_.linearArray()[n], false});
+        remaining.push_back({&source.unboundPartials_.linearArray()[n], &unboundPartials_.linearArray()[n], true});
+    }
+
+    // Transform all partials sharing an abscissa together, which will normally be all of them at once
+    while (!remaining.empty())
+    {
+        auto plan = Fourier::sineTransformPlan(*remaining.front().source, wMin, wStep, wMax, windowFunction, broadening);
+        auto sharesAbscissa = [&plan](const auto &t) { return t.source->xAxis() == plan->x(); };
+        auto batchEnd = std::stable_partition(remaining.begin(), remaining.end(), sharesAbscissa);
+
+        // Prepare destinations, reusing their existing storage if they are already on the target abscissa
+        std::vector<const double *> ys;
+        std::vector<double *> dests;
+        for (auto it = remaining.begin(); it != batchEnd; ++it)
+        {
+            if (it->destination->xAxis() != plan->w())
+            {
+                it->destination->initialise(plan->w().size());
+                it->destination->xAxis() = plan->w();
+            }
+            ys.push_back(it->source->values().data());
+            dests.push_back(it->destination->values().data());
+        }
+
+        plan->transform(ys, dests, normFactor);
+
+        // Subtract the transform of the offset, which is linear in the offset, from those partials requiring it
+        if (offset != 0.0)
+        {
+            std::vector<double> offsetFT(plan->w().size());
+            plan->transform(std::vector<double>(plan->x().size(), offset), offsetFT, normFactor);
+            for (auto it = remaining.begin(); it != batchEnd; ++it)
+                if (it->offset)
+                    std::transform(offsetFT.begin(), offsetFT.end(), it->destination->values().begin(),
+                                   it->destination->values().begin(), [](const auto ft, const auto y) { return y - ft; });
+        }
+
+        remaining.erase(remaining.begin(), batchEnd);
+    }
+
+    return true;
+}
+
 /*
  * Operators
  */
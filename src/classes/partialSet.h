@@ -6,7 +6,9 @@
 #include "classes/atomTypeMix.h"
 #include "classes/neutronWeights.h"
 #include "math/data1D.h"
+#include "math/function1D.h"
 #include "math/histogram1D.h"
+#include "math/windowFunction.h"
 #include "templates/array2D.h"
 
 // Forward Declarations
@@ -112,6 +114,10 @@ class PartialSet
     // Calculate RDF from supplied Histogram and normalisation data
     static void calculateRDF(Data1D &destination, const Histogram1D &histogram, double boxVolume, int nCentres,
                              int nSurrounding, double multiplier);
+    // Set partials from the Fourier sine transforms of those in the source PartialSet, subtracting the specified offset from
+    // the full and unbound source partials beforehand
+    bool sineFT(const PartialSet &source, double normFactor, double wMin, double wStep, double wMax,
+                const WindowFunction &windowFunction, const Function1DWrapper &broadening, double offset = 0.0);
 
     /*
      * Operators
@@ -8,9 +8,17 @@
 #include "classes/molecule.h"
 #include "classes/pairPotential.h"
 #include "classes/species.h"
+#include <algorithm>
+#include <map>
 
 // Clear all data
-void PotentialMap::clear() { potentialMatrix_.clear(); }
+void PotentialMap::clear()
+{
+    potentialMatrix_.clear();
+    packedIntervals_.clear();
+    packedTables_.clear();
+    packedVersions_.clear();
+}
 
 /*
  * Source Parameters
@@ -57,12 +65,59 @@ bool PotentialMap::initialise(const std::vector<std::shared_ptr<AtomType>> &mast
     // Store potential range
     range_ = pairPotentialRange;
 
+    // Pack tabulated potentials
+    packPotentials();
+
     return true;
 }
 
 // Return PairPotential range
 double PotentialMap::range() const { return range_; }
 
+/*
+ * Packed Potentials
+ */
+
+// Regenerate packed tables from the current PairPotentials
+void PotentialMap::packPotentials() const
+{
+    // The first interval is reserved as a zero-valued table for any type pairs without a PairPotential
+    packedIntervals_.assign(1, PotentialTable::Interval());
+    packedTables_.assign(nTypes_ * nTypes_, PackedTable());
+    packedVersions_.clear();
+
+    // Pack the table for each unique PairPotential, storing its location for both orderings of its types
+    std::map<const PairPotential *, PackedTable> packed;
+    for (auto typeI = 0; typeI < nTypes_; ++typeI)
+        for (auto typeJ = 0; typeJ < nTypes_; ++typeJ)
+        {
+            auto *pp = potentialMatrix_[{typeI, typeJ}];
+            if (!pp)
+                continue;
+
+            auto it = packed.find(pp);
+            if (it == packed.end())
+            {
+                auto &table = pp->totalTable();
+                it = packed
+                         .emplace(pp, PackedTable{static_cast<int>(packedIntervals_.size()), table.lastInterval(),
+                                                  table.rDelta()})
+                         .first;
+                packedIntervals_.insert(packedIntervals_.end(), table.intervals().begin(), table.intervals().end());
+                packedVersions_.emplace_back(pp, pp->tableVersion());
+            }
+            packedTables_[typeI * nTypes_ + typeJ] = it->second;
+        }
+}
+
+// Regenerate packed tables if the table of any PairPotential has changed since they were last packed
+void PotentialMap::updatePackedPotentials() const
+{
+    if (std::any_of(packedVersions_.begin(), packedVersions_.end(),
+                    [](const auto &ppVersion) { return ppVersion.first->tableVersion() != ppVersion.second; }))
+        packPotentials();
+}
+
 /*
  * Energy / Force
  */
@@ -75,10 +130,11 @@ double PotentialMap::energy(const Atom &i, const Atom &j, double r) const
 
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
-    auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
-    return pp->energy(r) + (PairPotential::includeCoulombPotential()
-                                ? 0
-                                : pp->analyticCoulombEnergy(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r));
+    auto energy = packedEnergy(i.masterTypeIndex(), j.masterTypeIndex(), r);
+    if (PairPotential::includeCoulombPotential())
+        return energy;
+    return energy + potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}]->analyticCoulombEnergy(
+                        i.speciesAtom()->charge() * j.speciesAtom()->charge(), r);
 }
 
 // Return energy between Atoms at distance specified, scaling electrostatic and short-range components
@@ -92,7 +148,7 @@ double PotentialMap::energy(const Atom &i, const Atom &j, double r, double elecS
     auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
     return PairPotential::includeCoulombPotential()
                ? pp->energy(r, elecScale, srScale)
-               : pp->energy(r) * srScale +
+               : packedEnergy(i.masterTypeIndex(), j.masterTypeIndex(), r) * srScale +
                      pp->analyticCoulombEnergy(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r) * elecScale;
 }
 
@@ -104,9 +160,11 @@ double PotentialMap::energy(const SpeciesAtom *i, const SpeciesAtom *j, double r
 
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
-    auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
-    return pp->energy(r) +
-           (PairPotential::includeCoulombPotential() ? 0 : pp->analyticCoulombEnergy(i->charge() * j->charge(), r));
+    auto energy = packedEnergy(i->atomType()->index(), j->atomType()->index(), r);
+    if (PairPotential::includeCoulombPotential())
+        return energy;
+    return energy + potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}]->analyticCoulombEnergy(
+                        i->charge() * j->charge(), r);
 }
 
 // Return energy between SpeciesAtoms at distance specified, scaling electrostatic and short-range components
@@ -120,7 +178,8 @@ double PotentialMap::energy(const SpeciesAtom *i, const SpeciesAtom *j, double r
     auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
     return PairPotential::includeCoulombPotential()
                ? pp->energy(r, elecScale, srScale)
-               : pp->energy(r) * srScale + pp->analyticCoulombEnergy(i->charge() * j->charge(), r) * elecScale;
+               : packedEnergy(i->atomType()->index(), j->atomType()->index(), r) * srScale +
+                     pp->analyticCoulombEnergy(i->charge() * j->charge(), r) * elecScale;
 }
 
 // Return analytic energy between Atom types at distance specified
@@ -154,10 +213,11 @@ double PotentialMap::force(const Atom &i, const Atom &j, double r) const
 {
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
-    auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
-    return PairPotential::includeCoulombPotential()
-               ? pp->force(r)
-               : pp->force(r) + pp->analyticCoulombForce(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r);
+    auto force = packedForce(i.masterTypeIndex(), j.masterTypeIndex(), r);
+    if (PairPotential::includeCoulombPotential())
+        return force;
+    return force + potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}]->analyticCoulombForce(
+                       i.speciesAtom()->charge() * j.speciesAtom()->charge(), r);
 }
 
 // Return force between Atoms at distance specified, scaling electrostatic and short-range components
@@ -168,7 +228,7 @@ double PotentialMap::force(const Atom &i, const Atom &j, double r, double elecSc
     auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
     return PairPotential::includeCoulombPotential()
                ? pp->force(r, elecScale, srScale)
-               : pp->force(r) * srScale +
+               : packedForce(i.masterTypeIndex(), j.masterTypeIndex(), r) * srScale +
                      pp->analyticCoulombForce(i.speciesAtom()->charge() * j.speciesAtom()->charge(), r) * elecScale;
 }
 
@@ -180,9 +240,11 @@ double PotentialMap::force(const SpeciesAtom *i, const SpeciesAtom *j, double r)
 
     // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
     // interpolated potential
-    auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
-    return PairPotential::includeCoulombPotential() ? pp->force(r)
-                                                    : pp->force(r) + pp->analyticCoulombForce(i->charge() * j->charge(), r);
+    auto force = packedForce(i->atomType()->index(), j->atomType()->index(), r);
+    if (PairPotential::includeCoulombPotential())
+        return force;
+    return force + potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}]->analyticCoulombForce(
+                       i->charge() * j->charge(), r);
 }
 
 // Return force between SpeciesAtoms at distance specified, scaling electrostatic and short-range components
@@ -196,7 +258,46 @@ double PotentialMap::force(const SpeciesAtom *i, const SpeciesAtom *j, double r,
     auto *pp = potentialMatrix_[{i->atomType()->index(), j->atomType()->index()}];
     return PairPotential::includeCoulombPotential()
                ? pp->force(r, elecScale, srScale)
-               : pp->force(r) * srScale + pp->analyticCoulombForce(i->charge() * j->charge(), r) * elecScale;
+               : packedForce(i->atomType()->index(), j->atomType()->index(), r) * srScale +
+                     pp->analyticCoulombForce(i->charge() * j->charge(), r) * elecScale;
+}
+
+// Return energy and force between Atoms at distance specified
+std::pair<double, double> PotentialMap::energyAndForce(const Atom &i, const Atom &j, double r) const
+{
+    assert(r >= 0.0);
+    assert(i.speciesAtom() && j.speciesAtom());
+
+    // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
+    // interpolated potential
+    auto [energy, force] = packedEnergyAndForce(i.masterTypeIndex(), j.masterTypeIndex(), r);
+    if (!PairPotential::includeCoulombPotential())
+    {
+        auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
+        auto qiqj = i.speciesAtom()->charge() * j.speciesAtom()->charge();
+        energy += pp->analyticCoulombEnergy(qiqj, r);
+        force += pp->analyticCoulombForce(qiqj, r);
+    }
+    return {energy, force};
+}
+
+// Return energy and force between Atoms at distance specified, scaling electrostatic and short-range components
+std::pair<double, double> PotentialMap::energyAndForce(const Atom &i, const Atom &j, double r, double elecScale,
+                                                       double srScale) const
+{
+    assert(r >= 0.0);
+    assert(i.speciesAtom() && j.speciesAtom());
+
+    // Check to see whether Coulomb terms should be calculated from atomic charges, rather than them being included in the
+    // interpolated potential
+    auto *pp = potentialMatrix_[{i.masterTypeIndex(), j.masterTypeIndex()}];
+    if (PairPotential::includeCoulombPotential())
+        return pp->energyAndForce(r, elecScale, srScale);
+
+    auto [energy, force] = packedEnergyAndForce(i.masterTypeIndex(), j.masterTypeIndex(), r);
+    auto qiqj = i.speciesAtom()->charge() * j.speciesAtom()->charge();
+    return {energy * srScale + pp->analyticCoulombEnergy(qiqj, r) * elecScale,
+            force * srScale + pp->analyticCoulombForce(qiqj, r) * elecScale};
 }
 
 // Return analytic force between Atom types at distance specified
@@ -25,7 +25,7 @@ class PotentialMap
      */
     private:
     // Number of unique types forming the matrix
-    int nTypes_;
+    int nTypes_{0};
     // PairPotential matrix
     Array2D<PairPotential *> potentialMatrix_;
     // PairPotential range
@@ -38,6 +38,54 @@ class PotentialMap
     // Return PairPotential range
     double range() const;
 
+    /*
+     * Packed Potentials
+     */
+    private:
+    // Location of a single type pair's table within the packed intervals
+    struct PackedTable
+    {
+        // Offset of first interval
+        int offset{0};
+        // Index of last interval, relative to the offset
+        int lastInterval{0};
+        // Reciprocal of grid spacing
+        double rDelta{0.0};
+    };
+    // Full potential tables for all type pairs, stored contiguously
+    mutable std::vector<PotentialTable::Interval> packedIntervals_;
+    // Table locations for all type pairs, indexed by (i * nTypes + j)
+    mutable std::vector<PackedTable> packedTables_;
+    // Unique PairPotentials and the versions of their tables when packed
+    mutable std::vector<std::pair<const PairPotential *, int>> packedVersions_;
+
+    private:
+    // Return energy from packed table for specified type pair
+    double packedEnergy(int typeI, int typeJ, double r) const
+    {
+        const auto &table = packedTables_[typeI * nTypes_ + typeJ];
+        return PotentialTable::energy(packedIntervals_.data() + table.offset, table.lastInterval, table.rDelta, r);
+    }
+    // Return force from packed table for specified type pair
+    double packedForce(int typeI, int typeJ, double r) const
+    {
+        const auto &table = packedTables_[typeI * nTypes_ + typeJ];
+        return PotentialTable::force(packedIntervals_.data() + table.offset, table.lastInterval, table.rDelta, r);
+    }
+    // Return energy and force from packed table for specified type pair
+    std::pair<double, double> packedEnergyAndForce(int typeI, int typeJ, double r) const
+    {
+        const auto &table = packedTables_[typeI * nTypes_ + typeJ];
+        return PotentialTable::energyAndForce(packedIntervals_.data() + table.offset, table.lastInterval, table.rDelta, r);
+    }
+
+    // Regenerate packed tables from the current PairPotentials
+    void packPotentials() const;
+
+    public:
+    // Regenerate packed tables if the table of any PairPotential has changed since they were last packed
+    void updatePackedPotentials() const;
+
     /*
      * Energy / Force
      */
@@ -62,6 +110,10 @@ class PotentialMap
     double force(const SpeciesAtom *i, const SpeciesAtom *j, double r) const;
     // Return force between SpeciesAtoms at distance specified, scaling electrostatic and short-range components
     double force(const SpeciesAtom *i, const SpeciesAtom *j, double r, double elecScale, double srScale) const;
+    // Return energy and force between Atoms at distance specified
+    std::pair<double, double> energyAndForce(const Atom &i, const Atom &j, double r) const;
+    // Return energy and force between Atoms at distance specified, scaling electrostatic and short-range components
+    std::pair<double, double> energyAndForce(const Atom &i, const Atom &j, double r, double elecScale, double srScale) const;
     // Return analytic force between Atom types at distance specified
     double analyticForce(const Atom &i, const Atom &j, double r) const;
     // Return analytic force between Atom types at distance specified, scaling electrostatic and short-range components
@@ -15,6 +15,7 @@
 #include "classes/speciesSite.h"
 #include "classes/speciesTorsion.h"
 #include "io/import/coordinates.h"
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -142,6 +143,12 @@ class Species : public Serialisable<const CoreData &>
     std::vector<SpeciesImproper> impropers_;
     // Whether the attached atoms lists have been created
     bool attachedAtomListsGenerated_;
+    // Maximum number of atoms for which a dense scaled interaction matrix will be created
+    static constexpr int maxScaledInteractionMatrixAtoms_ = 4096;
+    // Dense matrix of indices into scaledInteractionDefinitions_ for all atom pairs, empty if the Species is too large
+    std::vector<uint8_t> scaledInteractionMatrix_;
+    // Distinct scaled interaction definitions referenced by the matrix
+    std::vector<SpeciesAtom::ScaledInteractionDefinition> scaledInteractionDefinitions_;
 
     public:
     // Add new SpeciesBond definition
@@ -223,7 +230,7 @@ class Species : public Serialisable<const CoreData &>
     // Return the SpeciesImproper between the specified SpeciesAtom indices
     OptionalReferenceWrapper<SpeciesImproper> getImproper(int i, int j, int k, int l);
     OptionalReferenceWrapper<const SpeciesImproper> getImproper(int i, int j, int k, int l) const;
-    // Set-up excluded / scaled interactions on atoms
+    // Set-up excluded / scaled interactions on atoms, generating a dense lookup matrix if the Species is not too large
     void setUpScaledInteractions();
     // Return whether the attached atoms lists have been created
     bool attachedAtomListsGenerated() const;
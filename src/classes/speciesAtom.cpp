@@ -34,6 +34,10 @@ void SpeciesAtom::move(SpeciesAtom &source)
     torsions_ = std::move(source.torsions_);
     impropers_ = std::move(source.impropers_);
 
+    // Any dense scaled interaction row is indexed according to the atom's previous position, so is not retained
+    scaledInteractionRow_ = nullptr;
+    scaledInteractionDefinitions_ = nullptr;
+
     // Rewrite pointers in intramolecular terms
     for (auto &bond : bonds_)
         bond.get().switchAtom(&source, this);
@@ -285,9 +289,27 @@ void SpeciesAtom::setScaledInteractions()
     }
 }
 
+// Return vector of Atoms with scaled or excluded interactions
+const std::vector<std::pair<const SpeciesAtom *, SpeciesAtom::ScaledInteractionDefinition>> &
+SpeciesAtom::scaledInteractions() const
+{
+    return scaledInteractions_;
+}
+
+// Set row of parent Species' dense scaled interaction matrix, and the definitions it references
+void SpeciesAtom::setScaledInteractionRow(const uint8_t *row, const ScaledInteractionDefinition *definitions)
+{
+    scaledInteractionRow_ = row;
+    scaledInteractionDefinitions_ = definitions;
+}
+
 // Return scaling type and factors (electrostatic, van der Waals) to employ with specified Atom
 SpeciesAtom::ScaledInteractionDefinition SpeciesAtom::scaling(const SpeciesAtom *j) const
 {
+    // Use the dense matrix if both atoms have rows in the same one
+    if (scaledInteractionRow_ && j->scaledInteractionDefinitions_ == scaledInteractionDefinitions_)
+        return scaledInteractionDefinitions_[scaledInteractionRow_[j->index()]];
+
     auto it = std::find_if(scaledInteractions_.begin(), scaledInteractions_.end(), [j](const auto &p) { return p.first == j; });
     if (it != scaledInteractions_.end())
         return it->second;
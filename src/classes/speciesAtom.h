@@ -8,6 +8,7 @@
 #include "data/elements.h"
 #include "templates/optionalRef.h"
 #include "templates/vector3.h"
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -120,6 +121,10 @@ class SpeciesAtom : public Serialisable<CoreData &>
     std::vector<std::reference_wrapper<SpeciesImproper>> impropers_;
     // Vector of Atoms with scaled or excluded interactions
     std::vector<std::pair<const SpeciesAtom *, ScaledInteractionDefinition>> scaledInteractions_;
+    // Row of parent Species' dense scaled interaction matrix for this atom (if available)
+    const uint8_t *scaledInteractionRow_{nullptr};
+    // Scaled interaction definitions referenced by the row
+    const ScaledInteractionDefinition *scaledInteractionDefinitions_{nullptr};
 
     public:
     // Add bond reference
@@ -166,6 +171,10 @@ class SpeciesAtom : public Serialisable<CoreData &>
     const std::vector<std::reference_wrapper<SpeciesImproper>> &impropers() const;
     // Set all scaled intramolecular interactions
     void setScaledInteractions();
+    // Return vector of Atoms with scaled or excluded interactions
+    const std::vector<std::pair<const SpeciesAtom *, ScaledInteractionDefinition>> &scaledInteractions() const;
+    // Set row of parent Species' dense scaled interaction matrix, and the definitions it references
+    void setScaledInteractionRow(const uint8_t *row, const ScaledInteractionDefinition *definitions);
     // Return scaling type and factors (electrostatic, van der Waals) to employ with specified Atom
     ScaledInteractionDefinition scaling(const SpeciesAtom *j) const;
 
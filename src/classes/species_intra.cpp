@@ -9,6 +9,7 @@
 #include "data/atomicRadii.h"
 #include "templates/algorithms.h"
 #include <algorithm>
+#include <limits>
 
 /*
  * Public
@@ -445,6 +446,40 @@ void Species::setUpScaledInteractions()
 {
     for (auto &i : atoms_)
         i.setScaledInteractions();
+
+    // Generate a dense matrix of scaled interactions between all pairs of atoms, with each element indexing a distinct
+    // definition, so that lookups do not have to search each atom's scaled interactions
+    scaledInteractionDefinitions_ = {{SpeciesAtom::ScaledInteraction::NotScaled, 1.0, 1.0}};
+    scaledInteractionMatrix_.clear();
+    const auto n = nAtoms();
+    if (n <= maxScaledInteractionMatrixAtoms_)
+    {
+        scaledInteractionMatrix_.assign(n * n, 0);
+        for (auto &i : atoms_)
+        {
+            for (auto &&[j, definition] : i.scaledInteractions())
+            {
+                auto it = std::find(scaledInteractionDefinitions_.begin(), scaledInteractionDefinitions_.end(), definition);
+                if (it == scaledInteractionDefinitions_.end())
+                {
+                    // Too many distinct definitions to index - revert to searching
+                    if (scaledInteractionDefinitions_.size() > std::numeric_limits<uint8_t>::max())
+                    {
+                        scaledInteractionMatrix_.clear();
+                        break;
+                    }
+                    it = scaledInteractionDefinitions_.insert(scaledInteractionDefinitions_.end(), definition);
+                }
+                scaledInteractionMatrix_[i.index() * n + j->index()] = std::distance(scaledInteractionDefinitions_.begin(), it);
+            }
+            if (scaledInteractionMatrix_.empty())
+                break;
+        }
+    }
+
+    for (auto &i : atoms_)
+        i.setScaledInteractionRow(scaledInteractionMatrix_.empty() ? nullptr : &scaledInteractionMatrix_[i.index() * n],
+                                  scaledInteractionDefinitions_.data());
 }
 
 // Return whether the attached atoms lists have been created
@@ -2,7 +2,7 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "generator/add.h"
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "classes/box.h"
 #include "classes/configuration.h"
 #include "classes/species.h"
@@ -256,7 +256,7 @@ bool AddGeneratorNode::execute(const GeneratorContext &generatorContext)
     }
 
     // Now we add the molecules
-    RandomBuffer randomBuffer(generatorContext.processPool(), ProcessPool::PoolProcessesCommunicator);
+    RandomStream randomStream(generatorContext.processPool(), ProcessPool::PoolProcessesCommunicator);
     Vec3<double> r, cog, newCentre, fr;
     auto coordinateSetIndex = 0;
     auto hasCoordinateSets = false;
@@ -290,7 +290,7 @@ bool AddGeneratorNode::execute(const GeneratorContext &generatorContext)
         switch (positioningType_)
         {
             case (AddGeneratorNode::PositioningType::Random):
-                fr.set(randomBuffer.random(), randomBuffer.random(), randomBuffer.random());
+                fr.set(randomStream.random(), randomStream.random(), randomStream.random());
                 newCentre = box->getReal(fr);
                 mol->setCentreOfGeometry(box, newCentre);
                 break;
@@ -312,7 +312,7 @@ bool AddGeneratorNode::execute(const GeneratorContext &generatorContext)
         // Generate and apply a random rotation matrix
         if (rotate_)
         {
-            transform.createRotationXY(randomBuffer.randomPlusMinusOne() * 180.0, randomBuffer.randomPlusMinusOne() * 180.0);
+            transform.createRotationXY(randomStream.randomPlusMinusOne() * 180.0, randomStream.randomPlusMinusOne() * 180.0);
             mol->transform(box, transform);
         }
     }
@@ -2,7 +2,7 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "generator/addPair.h"
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "classes/box.h"
 #include "classes/configuration.h"
 #include "classes/coreData.h"
@@ -239,7 +239,7 @@ bool AddPairGeneratorNode::execute(const GeneratorContext &generatorContext)
     }
 
     // Now we add the molecules
-    RandomBuffer randomBuffer(generatorContext.processPool(), ProcessPool::PoolProcessesCommunicator);
+    RandomStream randomStream(generatorContext.processPool(), ProcessPool::PoolProcessesCommunicator);
     Vec3<double> r, cog, newCentre;
     Matrix3 transform;
     const auto *box = cfg->box();
@@ -263,7 +263,7 @@ bool AddPairGeneratorNode::execute(const GeneratorContext &generatorContext)
         switch (positioningType_)
         {
             case (AddPairGeneratorNode::PositioningType::Random):
-                newCentre = box->getReal({randomBuffer.random(), randomBuffer.random(), randomBuffer.random()});
+                newCentre = box->getReal({randomStream.random(), randomStream.random(), randomStream.random()});
                 break;
             case (AddPairGeneratorNode::PositioningType::Region):
                 newCentre = region_->region().randomCoordinate();
@@ -286,7 +286,7 @@ bool AddPairGeneratorNode::execute(const GeneratorContext &generatorContext)
         // Generate and apply a random rotation matrix
         if (rotate_)
         {
-            transform.createRotationXY(randomBuffer.randomPlusMinusOne() * 180.0, randomBuffer.randomPlusMinusOne() * 180.0);
+            transform.createRotationXY(randomStream.randomPlusMinusOne() * 180.0, randomStream.randomPlusMinusOne() * 180.0);
             molA->transform(box, transform, newCentre);
             molB->transform(box, transform, newCentre);
         }
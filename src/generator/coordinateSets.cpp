@@ -3,7 +3,7 @@
 
 #include "generator/coordinateSets.h"
 #include "base/lineParser.h"
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "base/sysFunc.h"
 #include "classes/configuration.h"
 #include "classes/species.h"
@@ -138,8 +138,8 @@ bool CoordinateSetsGeneratorNode::execute(const GeneratorContext &generatorConte
         return true;
     }
 
-    // Initialise the random number buffer for all processes
-    RandomBuffer randomBuffer(generatorContext.processPool(),
+    // Initialise the random number stream for all processes
+    RandomStream randomStream(generatorContext.processPool(),
                               ProcessPool::subDivisionStrategy(generatorContext.processPool().bestStrategy()));
 
     // Initialise random velocities
@@ -147,8 +147,8 @@ bool CoordinateSetsGeneratorNode::execute(const GeneratorContext &generatorConte
     std::generate(velocities.begin(), velocities.end(),
                   [&]()
                   {
-                      return Vec3<double>(exp(randomBuffer.random() - 0.5), exp(randomBuffer.random() - 0.5),
-                                          exp(randomBuffer.random() - 0.5)) /
+                      return Vec3<double>(exp(randomStream.random() - 0.5), exp(randomStream.random() - 0.5),
+                                          exp(randomStream.random() - 0.5)) /
                              sqrt(TWOPI);
                   });
 
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "io/binaryTrajectory.h"
+
+namespace BinaryTrajectory
+{
+// Return whether the header describes a readable trajectory
+bool FileHeader::isValid() const
+{
+    return identifier == BinaryTrajectory::identifier && version == BinaryTrajectory::version &&
+           (precision == sizeof(float) || precision == sizeof(double));
+}
+
+// Return size in bytes of a single frame, including its header
+uint64_t FileHeader::frameSize() const { return sizeof(FrameHeader) + nAtoms * 3 * precision; }
+
+// Return byte offset of the specified frame within the file
+uint64_t FileHeader::frameOffset(uint64_t index) const { return sizeof(FileHeader) + index * frameSize(); }
+} // namespace BinaryTrajectory
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/*
+ * Binary Trajectory Layout
+ *
+ * A binary trajectory consists of a single FileHeader followed by any number of frames, each comprising a FrameHeader and the
+ * coordinates of all atoms stored as consecutive (x,y,z) triplets of the precision given in the file header. Since every frame
+ * occupies the same number of bytes, any frame can be located directly from its index. Frame headers repeat the atom count
+ * and precision so that a frame can be read from any position without reference to the file header. Values are stored in
+ * native byte order.
+ */
+namespace BinaryTrajectory
+{
+// File identifier
+constexpr std::array<char, 8> identifier = {'D', 'I', 'S', 'S', 'T', 'R', 'J', '\0'};
+// Current format version
+constexpr uint32_t version = 1;
+
+// File Header
+struct FileHeader
+{
+    // File identifier
+    std::array<char, 8> identifier{BinaryTrajectory::identifier};
+    // Format version
+    uint32_t version{BinaryTrajectory::version};
+    // Size in bytes of each stored coordinate (4 or 8)
+    uint32_t precision{8};
+    // Number of atoms in each frame
+    uint64_t nAtoms{0};
+
+    // Return whether the header describes a readable trajectory
+    bool isValid() const;
+    // Return size in bytes of a single frame, including its header
+    uint64_t frameSize() const;
+    // Return byte offset of the specified frame within the file
+    uint64_t frameOffset(uint64_t index) const;
+};
+
+// Frame Header
+struct FrameHeader
+{
+    // Index of the frame within the file
+    uint64_t index{0};
+    // Number of atoms in the frame
+    uint64_t nAtoms{0};
+    // Size in bytes of each stored coordinate (4 or 8)
+    uint32_t precision{8};
+    // Reserved for future use
+    uint32_t reserved{0};
+    // Box axes matrix (column-major)
+    std::array<double, 9> axes{};
+};
+
+static_assert(sizeof(FileHeader) == 24, "Unexpected padding in BinaryTrajectory::FileHeader");
+static_assert(sizeof(FrameHeader) == 96, "Unexpected padding in BinaryTrajectory::FrameHeader");
+} // namespace BinaryTrajectory
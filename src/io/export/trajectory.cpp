@@ -7,13 +7,24 @@
 #include "classes/configuration.h"
 #include "classes/speciesAtom.h"
 #include "data/elements.h"
+#include "io/binaryTrajectory.h"
+#include <filesystem>
 
 TrajectoryExportFileFormat::TrajectoryExportFileFormat(std::string_view filename, TrajectoryExportFormat format)
     : FileAndFormat(formats_, filename, (int)format)
 {
-    formats_ = EnumOptions<TrajectoryExportFileFormat::TrajectoryExportFormat>(
-        "TrajectoryExportFileFormat", {{TrajectoryExportFormat::XYZ, "xyz", "XYZ Trajectory"},
-                                       {TrajectoryExportFormat::XYZExtended, "xyzExt", "XYZ Trajectory Extended"}});
+    formats_ = trajectoryExportFormats();
+}
+
+// Return enum options for TrajectoryExportFormat
+EnumOptions<TrajectoryExportFileFormat::TrajectoryExportFormat> TrajectoryExportFileFormat::trajectoryExportFormats()
+{
+    return EnumOptions<TrajectoryExportFileFormat::TrajectoryExportFormat>(
+        "TrajectoryExportFileFormat",
+        {{TrajectoryExportFormat::XYZ, "xyz", "XYZ Trajectory"},
+         {TrajectoryExportFormat::XYZExtended, "xyzExt", "XYZ Trajectory Extended"},
+         {TrajectoryExportFormat::Binary32, "bin32", "Binary Trajectory (Single Precision)"},
+         {TrajectoryExportFormat::Binary64, "bin64", "Binary Trajectory (Double Precision)"}});
 }
 
 /*
@@ -50,6 +61,51 @@ bool TrajectoryExportFileFormat::exportXYZ(LineParser &parser, Configuration *cf
     return true;
 }
 
+// Append binary frame to trajectory, writing the file header first if the file is new
+bool TrajectoryExportFileFormat::exportBinary(LineParser &parser, Configuration *cfg, uint32_t precision, bool fileExists)
+{
+    BinaryTrajectory::FileHeader header;
+    header.precision = precision;
+    header.nAtoms = cfg->nAtoms();
+
+    // Check that any existing file is compatible, and determine the index of the new frame from its size
+    BinaryTrajectory::FrameHeader frameHeader;
+    if (fileExists)
+    {
+        BinaryTrajectory::FileHeader existingHeader;
+        std::ifstream existingFile(filename_, std::ios::in | std::ios::binary);
+        if (!existingFile.read(reinterpret_cast<char *>(&existingHeader), sizeof(existingHeader)) ||
+            !existingHeader.isValid() || existingHeader.precision != header.precision ||
+            existingHeader.nAtoms != header.nAtoms)
+            return Messenger::error("Existing file '{}' is not a compatible binary trajectory.\n", filename_);
+        frameHeader.index = (std::filesystem::file_size(filename_) - sizeof(header)) / header.frameSize();
+    }
+    else if (!parser.writeBinary(reinterpret_cast<const char *>(&header), sizeof(header)))
+        return false;
+
+    // Write frame header
+    frameHeader.nAtoms = header.nAtoms;
+    frameHeader.precision = header.precision;
+    frameHeader.axes = cfg->box()->axes().matrix();
+    if (!parser.writeBinary(reinterpret_cast<const char *>(&frameHeader), sizeof(frameHeader)))
+        return false;
+
+    // Write coordinates in the requested precision
+    auto writeCoordinates = [&](auto value)
+    {
+        std::vector<decltype(value)> r(cfg->nAtoms() * 3);
+        auto it = r.begin();
+        for (const auto &i : cfg->atoms())
+        {
+            *it++ = i.r().x;
+            *it++ = i.r().y;
+            *it++ = i.r().z;
+        }
+        return parser.writeBinary(reinterpret_cast<const char *>(r.data()), r.size() * sizeof(value));
+    };
+    return precision == sizeof(float) ? writeCoordinates(float()) : writeCoordinates(double());
+}
+
 // Append trajectory using current filename and format
 bool TrajectoryExportFileFormat::exportData(Configuration *cfg)
 {
@@ -60,9 +116,11 @@ bool TrajectoryExportFileFormat::exportData(Configuration *cfg)
     // Make an initial check to see if the specified file exists
     auto fileExists = DissolveSys::fileExists(filename_);
 
-    // Open the specified file for appending
+    // Open the specified file for appending, in binary mode for binary formats
     LineParser parser;
-    if (!parser.appendOutput(filename_))
+    auto format = formats_.enumerationByIndex(*formatIndex_);
+    if (!parser.appendOutput(filename_,
+                             format == TrajectoryExportFormat::Binary32 || format == TrajectoryExportFormat::Binary64))
     {
         parser.closeFiles();
         return false;
@@ -93,6 +151,12 @@ bool TrajectoryExportFileFormat::exportData(Configuration *cfg)
         case (TrajectoryExportFormat::XYZExtended):
             frameResult = exportXYZ(parser, cfg, true);
             break;
+        case (TrajectoryExportFormat::Binary32):
+            frameResult = exportBinary(parser, cfg, sizeof(float), fileExists);
+            break;
+        case (TrajectoryExportFormat::Binary64):
+            frameResult = exportBinary(parser, cfg, sizeof(double), fileExists);
+            break;
         default:
             throw(std::runtime_error(fmt::format("Trajectory format '{}' export has not been implemented.\n",
                                                  formats_.keywordByIndex(*formatIndex_))));
@@ -16,8 +16,12 @@ class TrajectoryExportFileFormat : public FileAndFormat
     enum class TrajectoryExportFormat
     {
         XYZ,
-        XYZExtended
+        XYZExtended,
+        Binary32,
+        Binary64
     };
+    // Return enum options for TrajectoryExportFormat
+    static EnumOptions<TrajectoryExportFormat> trajectoryExportFormats();
     TrajectoryExportFileFormat(std::string_view filename = "", TrajectoryExportFormat format = TrajectoryExportFormat::XYZ);
     ~TrajectoryExportFileFormat() override = default;
 
@@ -41,6 +45,8 @@ class TrajectoryExportFileFormat : public FileAndFormat
     private:
     // Append XYZ frame to trajectory
     bool exportXYZ(LineParser &parser, Configuration *cfg, bool extended);
+    // Append binary frame to trajectory, writing the file header first if the file is new
+    bool exportBinary(LineParser &parser, Configuration *cfg, uint32_t precision, bool fileExists);
 
     public:
     // Append trajectory using current filename and format
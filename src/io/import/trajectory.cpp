@@ -13,10 +13,23 @@ TrajectoryImportFileFormat::TrajectoryImportFileFormat(std::string_view filename
 {
     formats_ = EnumOptions<TrajectoryImportFileFormat::TrajectoryImportFormat>(
         "TrajectoryImportFileFormat",
-        {{TrajectoryImportFormat::DLPOLYFormatted, "hisf", "Formatted DL_POLY Trajectory (no header)"},
+        {{TrajectoryImportFormat::Binary, "bin", "Binary Trajectory"},
+         {TrajectoryImportFormat::DLPOLYFormatted, "hisf", "Formatted DL_POLY Trajectory (no header)"},
          {TrajectoryImportFormat::XYZ, "xyz", "XYZ Trajectory"}});
 }
 
+/*
+ * Formats
+ */
+
+// Return current format
+std::optional<TrajectoryImportFileFormat::TrajectoryImportFormat> TrajectoryImportFileFormat::format() const
+{
+    if (!formatIndex_)
+        return {};
+    return formats_.enumerationByIndex(*formatIndex_);
+}
+
 /*
  * Import Functions
  */
@@ -33,6 +46,17 @@ bool TrajectoryImportFileFormat::importData(LineParser &parser, Configuration *c
     auto result = false;
     switch (formats_.enumerationByIndex(*formatIndex_))
     {
+        case (TrajectoryImportFormat::Binary):
+            result = importBinary(parser, r, unitCell);
+            if (result)
+            {
+                if (r.size() != cfg->nAtoms())
+                    return Messenger::error("Binary trajectory frame contains {} atoms but the configuration has {}.\n",
+                                            r.size(), cfg->nAtoms());
+                for (auto &&[i, ri] : zip(cfg->atoms(), r))
+                    i.setCoordinates(ri);
+            }
+            break;
         case (TrajectoryImportFormat::DLPOLYFormatted):
             result = importDLPOLY(parser, r, unitCell);
             if (result)
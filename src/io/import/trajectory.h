@@ -17,6 +17,7 @@ class TrajectoryImportFileFormat : public FileAndFormat
     // Available trajectory formats
     enum class TrajectoryImportFormat
     {
+        Binary,
         DLPOLYFormatted,
         XYZ
     };
@@ -32,6 +33,10 @@ class TrajectoryImportFileFormat : public FileAndFormat
     // Format enum options
     EnumOptions<TrajectoryImportFileFormat::TrajectoryImportFormat> formats_;
 
+    public:
+    // Return current format
+    std::optional<TrajectoryImportFormat> format() const;
+
     /*
      * Filename / Basename
      */
@@ -45,6 +50,8 @@ class TrajectoryImportFileFormat : public FileAndFormat
     private:
     // Import DL_POLY coordinates through specified parser
     bool importDLPOLY(LineParser &parser, std::vector<Vec3<double>> &r, std::optional<Matrix3> &unitCell);
+    // Import binary trajectory frame through specified parser
+    bool importBinary(LineParser &parser, std::vector<Vec3<double>> &r, std::optional<Matrix3> &unitCell);
 
     public:
     // Import trajectory using supplied parser and current format
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "io/import/trajectoryReader.h"
+#include "base/lineScanner.h"
+#include "base/messenger.h"
+#include "io/binaryTrajectory.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+TrajectoryReader::~TrajectoryReader() { cancelPrefetch(); }
+
+/*
+ * Source
+ */
+
+// Index any frames in the mapped file beyond those already indexed
+bool TrajectoryReader::indexFrames()
+{
+    // Binary frames are all the same size, so can be indexed directly from the file header
+    if (format_ == TrajectoryImportFileFormat::TrajectoryImportFormat::Binary)
+    {
+        BinaryTrajectory::FileHeader header;
+        if (file_.size() < sizeof(header))
+            return Messenger::error("File '{}' is too small to be a binary trajectory.\n", file_.filename());
+        std::memcpy(&header, file_.data(), sizeof(header));
+        if (!header.isValid())
+            return Messenger::error("File '{}' is not a binary trajectory, or was written by an incompatible version.\n",
+                                    file_.filename());
+        for (auto n = frameOffsets_.size(); header.frameOffset(n + 1) <= file_.size(); ++n)
+            frameOffsets_.push_back(header.frameOffset(n));
+        indexedSize_ = header.frameOffset(frameOffsets_.size());
+        return true;
+    }
+
+    // Text formats - determine the number of lines in each frame from its header, and skip over them
+    LineScanner scanner(file_.data() + indexedSize_, file_.data() + file_.size());
+    while (!scanner.onlyWhitespaceRemains())
+    {
+        scanner.skipWhitespace();
+        auto offset = static_cast<std::size_t>(scanner.position() - file_.data());
+        std::size_t nLines = 0;
+        long int nAtoms;
+        if (format_ == TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ)
+        {
+            if (!scanner.readInteger(nAtoms))
+                return Messenger::error("Failed to read number of atoms in frame {} of '{}'.\n", frameOffsets_.size() + 1,
+                                        file_.filename());
+            nLines = nAtoms + 2;
+        }
+        else
+        {
+            // Header line contains 'timestep', step, natoms, keytrj, imcon, ...
+            long int step, keytrj, imcon;
+            if (!scanner.skipField() || !scanner.readInteger(step) || !scanner.readInteger(nAtoms) ||
+                !scanner.readInteger(keytrj) || !scanner.readInteger(imcon))
+                return Messenger::error("Failed to read header of frame {} of '{}'.\n", frameOffsets_.size() + 1,
+                                        file_.filename());
+            nLines = 1 + (imcon > 0 ? 3 : 0) + nAtoms * (2 + keytrj);
+        }
+        if (nAtoms <= 0)
+            return Messenger::error("Invalid number of atoms ({}) in frame {} of '{}'.\n", nAtoms, frameOffsets_.size() + 1,
+                                    file_.filename());
+
+        // Ignore any incomplete final frame, since it may still be being written
+        if (!scanner.skipLines(nLines))
+            break;
+        frameOffsets_.push_back(offset);
+        indexedSize_ = scanner.position() - file_.data();
+    }
+
+    return true;
+}
+
+// Open specified file in the given format, indexing its frames
+bool TrajectoryReader::open(std::string_view filename, TrajectoryImportFileFormat::TrajectoryImportFormat format)
+{
+    close();
+
+    if (!file_.open(filename))
+        return false;
+    format_ = format;
+
+    if (!indexFrames())
+    {
+        close();
+        return false;
+    }
+
+    Messenger::print("Indexed {} frame(s) in trajectory file '{}'.\n", frameOffsets_.size(), filename);
+
+    return true;
+}
+
+// Close current file
+void TrajectoryReader::close()
+{
+    cancelPrefetch();
+    frameOffsets_.clear();
+    indexedSize_ = 0;
+    file_.close();
+}
+
+// Return whether the specified file is open in the given format, indexing any frames appended since it was last indexed
+bool TrajectoryReader::isOpen(std::string_view filename, TrajectoryImportFileFormat::TrajectoryImportFormat format)
+{
+    if (!file_.isOpen() || file_.filename() != filename || format_ != format)
+        return false;
+
+    // A file which has shrunk must be re-indexed from scratch
+    std::error_code error;
+    auto size = std::filesystem::file_size(std::string(filename), error);
+    if (error || size < file_.size())
+        return false;
+    if (size == file_.size())
+        return true;
+
+    // The file has grown, so remap it and index only the appended data
+    cancelPrefetch();
+    auto nIndexed = frameOffsets_.size();
+    if (!file_.open(std::string(filename)) || !indexFrames())
+    {
+        close();
+        return false;
+    }
+
+    Messenger::print("Indexed {} new frame(s) in trajectory file '{}'.\n", frameOffsets_.size() - nIndexed, filename);
+
+    return true;
+}
+
+// Return number of complete frames in the file
+int TrajectoryReader::nFrames() const { return frameOffsets_.size(); }
+
+// Return index of the frame starting at the specified byte offset, if any
+std::optional<int> TrajectoryReader::frameAt(std::size_t offset) const
+{
+    auto it = std::lower_bound(frameOffsets_.begin(), frameOffsets_.end(), offset);
+    if (it == frameOffsets_.end() || *it != offset)
+        return {};
+    return it - frameOffsets_.begin();
+}
+
+/*
+ * Frame Parsing
+ */
+
+// Parse frame at the specified offset
+std::optional<TrajectoryReader::Frame> TrajectoryReader::parseXYZ(std::size_t offset) const
+{
+    LineScanner scanner(file_.data() + offset, file_.data() + file_.size());
+    Frame frame;
+
+    // Number of atoms and title
+    long int nAtoms;
+    if (!scanner.readInteger(nAtoms) || !scanner.skipLines(2))
+        return {};
+
+    // Coordinates
+    frame.r.resize(nAtoms);
+    for (auto &r : frame.r)
+    {
+        if (!scanner.skipField() || !scanner.readDouble(r.x) || !scanner.readDouble(r.y) || !scanner.readDouble(r.z))
+            return {};
+        scanner.nextLine();
+    }
+
+    return frame;
+}
+std::optional<TrajectoryReader::Frame> TrajectoryReader::parseDLPOLY(std::size_t offset) const
+{
+    LineScanner scanner(file_.data() + offset, file_.data() + file_.size());
+    Frame frame;
+
+    // Header line
+    long int step, nAtoms, keytrj, imcon;
+    if (!scanner.skipField() || !scanner.readInteger(step) || !scanner.readInteger(nAtoms) || !scanner.readInteger(keytrj) ||
+        !scanner.readInteger(imcon) || !scanner.skipLines(1))
+        return {};
+
+    // Cell information if given
+    if (imcon > 0)
+    {
+        Matrix3 cell;
+        for (auto n = 0; n < 3; ++n)
+        {
+            Vec3<double> v;
+            if (!scanner.readDouble(v.x) || !scanner.readDouble(v.y) || !scanner.readDouble(v.z))
+                return {};
+            cell.setColumn(n, v);
+            scanner.nextLine();
+        }
+        frame.unitCell = cell;
+    }
+
+    // Coordinates - skip atom name line, get the positions, then skip velocity and force lines if present
+    frame.r.resize(nAtoms);
+    for (auto &r : frame.r)
+    {
+        if (!scanner.skipLines(1) || !scanner.readDouble(r.x) || !scanner.readDouble(r.y) || !scanner.readDouble(r.z))
+            return {};
+        scanner.skipLines(1 + keytrj);
+    }
+
+    return frame;
+}
+std::optional<TrajectoryReader::Frame> TrajectoryReader::parseBinary(std::size_t offset) const
+{
+    BinaryTrajectory::FrameHeader header;
+    std::memcpy(&header, file_.data() + offset, sizeof(header));
+    if ((header.precision != sizeof(float) && header.precision != sizeof(double)) ||
+        offset + sizeof(header) + header.nAtoms * 3 * header.precision > file_.size())
+        return {};
+
+    Frame frame;
+    Matrix3 cell;
+    std::copy(header.axes.begin(), header.axes.end(), &cell[0]);
+    frame.unitCell = cell;
+
+    auto *data = file_.data() + offset + sizeof(header);
+    auto unpack = [&](auto value)
+    {
+        frame.r.resize(header.nAtoms);
+        for (auto &r : frame.r)
+        {
+            decltype(value) xyz[3];
+            std::memcpy(xyz, data, sizeof(xyz));
+            r.set(xyz[0], xyz[1], xyz[2]);
+            data += sizeof(xyz);
+        }
+    };
+    if (header.precision == sizeof(float))
+        unpack(float());
+    else
+        unpack(double());
+
+    return frame;
+}
+
+// Parse specified frame
+std::optional<TrajectoryReader::Frame> TrajectoryReader::parseFrame(int index) const
+{
+    if (index < 0 || index >= frameOffsets_.size())
+        return {};
+
+    switch (format_)
+    {
+        case (TrajectoryImportFileFormat::TrajectoryImportFormat::Binary):
+            return parseBinary(frameOffsets_[index]);
+        case (TrajectoryImportFileFormat::TrajectoryImportFormat::DLPOLYFormatted):
+            return parseDLPOLY(frameOffsets_[index]);
+        case (TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ):
+            return parseXYZ(frameOffsets_[index]);
+        default:
+            return {};
+    }
+}
+
+// Discard any frame being read in the background
+void TrajectoryReader::cancelPrefetch()
+{
+    if (prefetchFrame_.valid())
+        prefetchFrame_.wait();
+    prefetchFrame_ = {};
+    prefetchIndex_ = std::nullopt;
+}
+
+// Read specified frame, using the background read if it is the same frame
+std::optional<TrajectoryReader::Frame> TrajectoryReader::read(int index)
+{
+    if (prefetchIndex_ == index && prefetchFrame_.valid())
+    {
+        prefetchIndex_ = std::nullopt;
+        return prefetchFrame_.get();
+    }
+
+    cancelPrefetch();
+    return parseFrame(index);
+}
+
+// Begin reading the specified frame in the background
+void TrajectoryReader::prefetch(int index)
+{
+    cancelPrefetch();
+    if (index < 0 || index >= frameOffsets_.size())
+        return;
+
+#ifdef MULTITHREADING
+    prefetchIndex_ = index;
+    prefetchFrame_ = std::async(std::launch::async, [this, index]() { return parseFrame(index); });
+#endif
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "base/mappedFile.h"
+#include "io/import/trajectory.h"
+#include "math/matrix3.h"
+#include <future>
+#include <optional>
+#include <vector>
+
+/*
+ * Trajectory Reader
+ *
+ * Provides random access to the frames of a trajectory file by memory-mapping it and indexing the start of every frame once on
+ * opening, and of any frames appended to it subsequently. Frames are parsed directly from the mapped data, and the next frame
+ * required may be parsed in the background while the current one is in use.
+ */
+class TrajectoryReader
+{
+    public:
+    TrajectoryReader() = default;
+    ~TrajectoryReader();
+    TrajectoryReader(const TrajectoryReader &) = delete;
+    TrajectoryReader &operator=(const TrajectoryReader &) = delete;
+
+    // Frame Data
+    struct Frame
+    {
+        // Atomic coordinates
+        std::vector<Vec3<double>> r;
+        // Unit cell axes (if provided)
+        std::optional<Matrix3> unitCell;
+    };
+
+    /*
+     * Source
+     */
+    private:
+    // Mapped trajectory file
+    MappedFile file_;
+    // Format of trajectory
+    TrajectoryImportFileFormat::TrajectoryImportFormat format_{TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ};
+    // Byte offsets of the start of each complete frame
+    std::vector<std::size_t> frameOffsets_;
+    // Byte offset of the end of the last complete frame indexed
+    std::size_t indexedSize_{0};
+
+    private:
+    // Index any frames in the mapped file beyond those already indexed
+    bool indexFrames();
+
+    public:
+    // Open specified file in the given format, indexing its frames
+    bool open(std::string_view filename, TrajectoryImportFileFormat::TrajectoryImportFormat format);
+    // Close current file
+    void close();
+    // Return whether the specified file is open in the given format, indexing any frames appended since it was last indexed
+    bool isOpen(std::string_view filename, TrajectoryImportFileFormat::TrajectoryImportFormat format);
+    // Return number of complete frames in the file
+    int nFrames() const;
+    // Return index of the frame starting at the specified byte offset, if any
+    std::optional<int> frameAt(std::size_t offset) const;
+
+    /*
+     * Frame Parsing
+     */
+    private:
+    // Index and parsed data of frame being read in the background
+    std::optional<int> prefetchIndex_;
+    std::future<std::optional<Frame>> prefetchFrame_;
+
+    private:
+    // Parse frame at the specified offset
+    std::optional<Frame> parseXYZ(std::size_t offset) const;
+    std::optional<Frame> parseDLPOLY(std::size_t offset) const;
+    std::optional<Frame> parseBinary(std::size_t offset) const;
+    // Parse specified frame
+    std::optional<Frame> parseFrame(int index) const;
+    // Discard any frame being read in the background
+    void cancelPrefetch();
+
+    public:
+    // Read specified frame, using the background read if it is the same frame
+    std::optional<Frame> read(int index);
+    // Begin reading the specified frame in the background
+    void prefetch(int index);
+};
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/lineParser.h"
+#include "io/binaryTrajectory.h"
+#include "io/import/trajectory.h"
+#include <algorithm>
+
+// Import binary trajectory frame through specified parser
+bool TrajectoryImportFileFormat::importBinary(LineParser &parser, std::vector<Vec3<double>> &r,
+                                              std::optional<Matrix3> &unitCell)
+{
+    Messenger::print(" --> Importing trajectory frame in binary format...\n");
+
+    // Read the first field of the frame header - at the start of the file we will find the file header instead
+    BinaryTrajectory::FrameHeader frameHeader;
+    auto *frameData = reinterpret_cast<char *>(&frameHeader);
+    if (!parser.readBinary(frameData, sizeof(frameHeader.index)))
+        return false;
+    if (std::equal(BinaryTrajectory::identifier.begin(), BinaryTrajectory::identifier.end(), frameData))
+    {
+        BinaryTrajectory::FileHeader fileHeader;
+        auto *fileData = reinterpret_cast<char *>(&fileHeader);
+        if (!parser.readBinary(fileData + sizeof(frameHeader.index), sizeof(fileHeader) - sizeof(frameHeader.index)))
+            return false;
+        if (!fileHeader.isValid())
+            return Messenger::error("File is not a binary trajectory, or was written by an incompatible version.\n");
+
+        if (!parser.readBinary(frameData, sizeof(frameHeader.index)))
+            return false;
+    }
+
+    // Read the remainder of the frame header
+    if (!parser.readBinary(frameData + sizeof(frameHeader.index), sizeof(frameHeader) - sizeof(frameHeader.index)))
+        return false;
+    if (frameHeader.precision != sizeof(float) && frameHeader.precision != sizeof(double))
+        return Messenger::error("Binary trajectory frame {} has an invalid precision ({}).\n", frameHeader.index,
+                                frameHeader.precision);
+    Messenger::print(" --> Frame {} contains coordinates for {} atoms.\n", frameHeader.index, frameHeader.nAtoms);
+
+    Matrix3 cell;
+    std::copy(frameHeader.axes.begin(), frameHeader.axes.end(), &cell[0]);
+    unitCell = cell;
+
+    // Read coordinates in the stored precision
+    auto readCoordinates = [&](auto value)
+    {
+        std::vector<decltype(value)> data(frameHeader.nAtoms * 3);
+        if (!parser.readBinary(reinterpret_cast<char *>(data.data()), data.size() * sizeof(value)))
+            return false;
+        r.resize(frameHeader.nAtoms);
+        for (auto n = 0; n < r.size(); ++n)
+            r[n].set(data[n * 3], data[n * 3 + 1], data[n * 3 + 2]);
+        return true;
+    };
+    return frameHeader.precision == sizeof(float) ? readCoordinates(float()) : readCoordinates(double());
+}
@@ -3,15 +3,22 @@
 
 #include "kernels/base.h"
 #include "classes/configuration.h"
+#include "classes/neighbourList.h"
 #include "classes/potentialMap.h"
 
 KernelBase::KernelBase(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                       std::optional<double> energyCutoff)
+                       std::optional<double> energyCutoff, OptionalReferenceWrapper<const NeighbourList> neighbourList)
     : processPool_(procPool), potentialMap_(potentialMap), box_(cfg->box()), cellArray_(cfg->cells()),
-      molecules_(cfg->molecules())
+      molecules_(cfg->molecules()), configuration_(cfg), neighbourList_(neighbourList)
 {
     cutoffDistanceSquared_ =
         energyCutoff.has_value() ? energyCutoff.value() * energyCutoff.value() : potentialMap_.range() * potentialMap_.range();
+
+    // Pick up any changes to individual PairPotentials since the map's tables were packed
+    potentialMap_.updatePackedPotentials();
+
+    // Any neighbour list must have been built for at least our cutoff
+    assert(!neighbourList_ || neighbourList_->get().cutoff() * neighbourList_->get().cutoff() >= cutoffDistanceSquared_);
 }
 
 KernelBase::KernelBase(const Box *box, const ProcessPool &procPool, const PotentialMap &potentialMap,
@@ -20,4 +27,7 @@ KernelBase::KernelBase(const Box *box, const ProcessPool &procPool, const Potent
 {
     cutoffDistanceSquared_ =
         energyCutoff.has_value() ? energyCutoff.value() * energyCutoff.value() : potentialMap_.range() * potentialMap_.range();
+
+    // Pick up any changes to individual PairPotentials since the map's tables were packed
+    potentialMap_.updatePackedPotentials();
 }
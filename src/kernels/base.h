@@ -13,6 +13,7 @@ class Box;
 class CellArray;
 class Configuration;
 class Molecule;
+class NeighbourList;
 class PotentialMap;
 class ProcessPool;
 
@@ -21,7 +22,7 @@ class KernelBase
 {
     public:
     KernelBase(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-               std::optional<double> energyCutoff = {});
+               std::optional<double> energyCutoff = {}, OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     KernelBase(const Box *box, const ProcessPool &procPool, const PotentialMap &potentialMap,
                std::optional<double> energyCutoff = {});
     ~KernelBase() = default;
@@ -42,4 +43,8 @@ class KernelBase
     OptionalReferenceWrapper<const CellArray> cellArray_;
     // Target molecule array (if available))
     OptionalReferenceWrapper<const std::vector<std::shared_ptr<Molecule>>> molecules_;
+    // Source Configuration (if available)
+    const Configuration *configuration_{nullptr};
+    // Verlet neighbour list for intermolecular pair potential terms (optional)
+    OptionalReferenceWrapper<const NeighbourList> neighbourList_;
 };
@@ -5,7 +5,10 @@
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
+#include "classes/coordinateBlock.h"
+#include "classes/minimumImage.h"
 #include "classes/molecule.h"
+#include "classes/neighbourList.h"
 #include "classes/potentialMap.h"
 #include "classes/species.h"
 #include "templates/algorithms.h"
@@ -54,8 +57,8 @@ double PairPotentialEnergyValue::total() const { return interMolecular_ + intraM
  */
 
 EnergyKernel::EnergyKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                           std::optional<double> energyCutoff)
-    : GeometryKernel(cfg, procPool, potentialMap, energyCutoff)
+                           std::optional<double> energyCutoff, OptionalReferenceWrapper<const NeighbourList> neighbourList)
+    : GeometryKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList)
 {
 }
 
@@ -77,37 +80,39 @@ double EnergyKernel::pairPotentialEnergy(const Atom &i, const Atom &j, double r,
  */
 
 // Return PairPotential energy of atoms in the supplied cell
-PairPotentialEnergyValue EnergyKernel::cellEnergy(const Cell &cell, bool includeIntraMolecular) const
+PairPotentialEnergyValue EnergyKernel::cellEnergy(const CoordinateBlock &coords, const Cell &cell,
+                                                  bool includeIntraMolecular) const
 {
-    PairPotentialEnergyValue totalEnergy;
-    auto &atoms = cell.atoms();
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    auto begin = coords.cellBegin(cell.index()), end = coords.cellEnd(cell.index());
 
-    for (auto i = 0; i < atoms.size(); ++i)
+    PairPotentialEnergyValue totalEnergy;
+    for (auto i = begin; i < end; ++i)
     {
-        auto &ii = atoms[i];
-        auto molI = ii->molecule();
-        auto &rI = ii->r();
+        const auto *molI = molecules[i];
+        auto xi = x[i], yi = y[i], zi = z[i];
 
         // Straight loop over other cell atoms
-        for (auto j = i + 1; j < atoms.size(); ++j)
+        for (auto j = i + 1; j < end; ++j)
         {
             // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-            auto &jj = atoms[j];
-
-            auto rSq = (rI - jj->r()).magnitudeSq();
+            auto dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+            auto rSq = dx * dx + dy * dy + dz * dz;
             if (rSq > cutoffDistanceSquared_)
                 continue;
 
             // Check for atoms in the same molecule
-            if (molI != jj->molecule())
-                totalEnergy.addInterMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
+            if (molI != molecules[j])
+                totalEnergy.addInterMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq)));
             else if (includeIntraMolecular)
             {
-                auto &&[scalingType, elec14, vdw14] = ii->scaling(jj);
+                auto &&[scalingType, elec14, vdw14] = atoms[i]->scaling(atoms[j]);
                 if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
-                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
+                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq)));
                 else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
-                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq), elec14, vdw14));
+                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq), elec14, vdw14));
             }
         }
     }
@@ -116,69 +121,75 @@ PairPotentialEnergyValue EnergyKernel::cellEnergy(const Cell &cell, bool include
 }
 
 // Return PairPotential energy between atoms in supplied cells
-PairPotentialEnergyValue EnergyKernel::cellToCellEnergy(const Cell &centralCell, const Cell &otherCell, bool applyMim,
-                                                        bool includeIntraMolecular) const
+PairPotentialEnergyValue EnergyKernel::cellToCellEnergy(const CoordinateBlock &coords, const Cell &centralCell,
+                                                        const Cell &otherCell, bool applyMim, bool includeIntraMolecular) const
 {
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    auto beginI = coords.cellBegin(centralCell.index()), endI = coords.cellEnd(centralCell.index());
+    auto beginJ = coords.cellBegin(otherCell.index()), endJ = coords.cellEnd(otherCell.index());
+
     PairPotentialEnergyValue totalEnergy;
-    auto &centralAtoms = centralCell.atoms();
-    auto &otherAtoms = otherCell.atoms();
 
-    // Loop over central cell atoms
-    if (applyMim)
+    // Accumulate energy between atoms i and j at squared distance rSq
+    auto addPairEnergy = [&](int i, int j, double rSq)
     {
-        for (auto &ii : centralAtoms)
+        // Check for atoms in the same molecule
+        if (molecules[i] != molecules[j])
+            totalEnergy.addInterMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq)));
+        else if (includeIntraMolecular)
         {
-            auto molI = ii->molecule();
-            auto &rI = ii->r();
+            auto &&[scalingType, elec14, vdw14] = atoms[i]->scaling(atoms[j]);
+            if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
+                totalEnergy.addIntraMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq)));
+            else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
+                totalEnergy.addIntraMolecular(pairPotentialEnergy(*atoms[i], *atoms[j], sqrt(rSq), elec14, vdw14));
+        }
+    };
 
-            // Straight loop over other cell atoms
-            for (const auto &jj : otherAtoms)
-            {
-                // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-                auto rSq = box_->minimumDistanceSquared(rI, jj->r());
-                if (rSq > cutoffDistanceSquared_)
-                    continue;
+    // Loop over central cell atoms
+    if (applyMim)
+    {
+        MinimumImage::dispatch(*box_,
+                               [&](const auto mim)
+                               {
+                                   for (auto i = beginI; i < endI; ++i)
+                                   {
+                                       auto xi = x[i], yi = y[i], zi = z[i];
+
+                                       // Straight loop over other cell atoms
+                                       for (auto j = beginJ; j < endJ; ++j)
+                                       {
+                                           // Calculate minimum image rSquared distance between atoms, and check it against
+                                           // the stored cutoff distance
+                                           auto dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+                                           mim.apply(dx, dy, dz);
+                                           auto rSq = dx * dx + dy * dy + dz * dz;
+                                           if (rSq > cutoffDistanceSquared_)
+                                               continue;
 
-                // Check for atoms in the same species
-                if (molI != jj->molecule())
-                    totalEnergy.addInterMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
-                else if (includeIntraMolecular)
-                {
-                    auto &&[scalingType, elec14, vdw14] = ii->scaling(jj);
-                    if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
-                        totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
-                    else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
-                        totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq), elec14, vdw14));
-                }
-            }
-        }
+                                           addPairEnergy(i, j, rSq);
+                                       }
+                                   }
+                               });
     }
     else
     {
-        for (auto &ii : centralAtoms)
+        for (auto i = beginI; i < endI; ++i)
         {
-            auto &molI = ii->molecule();
-            auto &rI = ii->r();
+            auto xi = x[i], yi = y[i], zi = z[i];
 
             // Straight loop over other cell atoms
-            for (const auto &jj : otherAtoms)
+            for (auto j = beginJ; j < endJ; ++j)
             {
                 // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
-                auto rSq = (rI - jj->r()).magnitudeSq();
+                auto dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+                auto rSq = dx * dx + dy * dy + dz * dz;
                 if (rSq > cutoffDistanceSquared_)
                     continue;
 
-                // Check for atoms in the same molecule
-                if (molI != jj->molecule())
-                    totalEnergy.addInterMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
-                else if (includeIntraMolecular)
-                {
-                    auto &&[scalingType, elec14, vdw14] = ii->scaling(jj);
-                    if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
-                        totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq)));
-                    else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
-                        totalEnergy.addIntraMolecular(pairPotentialEnergy(*ii, *jj, sqrt(rSq), elec14, vdw14));
-                }
+                addPairEnergy(i, j, rSq);
             }
         }
     }
@@ -186,40 +197,94 @@ PairPotentialEnergyValue EnergyKernel::cellToCellEnergy(const Cell &centralCell,
     return totalEnergy;
 }
 
+// Return PairPotential energy between specified owning atom in neighbour list and its neighbours
+PairPotentialEnergyValue EnergyKernel::neighbourListEnergy(const NeighbourList &neighbourList, int ownerIndex) const
+{
+    auto &atoms = configuration_->atoms();
+    auto &i = atoms[neighbourList.owner(ownerIndex)];
+
+    // Pairs are stored irrespective of their cell locations, so minimum image is always applied
+    return MinimumImage::dispatch(
+        *box_,
+        [&](const auto mim)
+        {
+            return std::accumulate(neighbourList.neighboursBegin(ownerIndex), neighbourList.neighboursEnd(ownerIndex),
+                                   PairPotentialEnergyValue(),
+                                   [&](const auto acc, const auto indexJ)
+                                   {
+                                       auto &j = atoms[indexJ];
+                                       auto rSq = MinimumImage::distanceSquared(mim, i.r(), j.r());
+                                       if (rSq > cutoffDistanceSquared_)
+                                           return acc;
+                                       return acc + PairPotentialEnergyValue(pairPotentialEnergy(i, j, sqrt(rSq)), 0.0);
+                                   });
+        });
+}
+
+// Return intramolecular PairPotential energy of Molecule
+PairPotentialEnergyValue EnergyKernel::intraMolecularEnergy(const Molecule &mol) const
+{
+    PairPotentialEnergyValue totalEnergy;
+    dissolve::for_each_pair(ParallelPolicies::seq, mol.atoms().begin(), mol.atoms().end(),
+                            [&](int indexI, const auto &i, int indexJ, const auto &j)
+                            {
+                                if (indexI == indexJ)
+                                    return;
+                                auto rSq = box_->minimumDistanceSquared(i->r(), j->r());
+                                if (rSq > cutoffDistanceSquared_)
+                                    return;
+                                auto &&[scalingType, elec14, vdw14] = i->scaling(j);
+                                if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
+                                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*i, *j, sqrt(rSq)));
+                                else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
+                                    totalEnergy.addIntraMolecular(pairPotentialEnergy(*i, *j, sqrt(rSq), elec14, vdw14));
+                            });
+    return totalEnergy;
+}
+
 // Return PairPotential energy of Atom with world
 double EnergyKernel::pairPotentialEnergy(const Atom &i) const
 {
     assert(cellArray_);
     auto &cells = cellArray_->get();
+    auto &coords = cells.coordinates();
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    const auto rI = i.r();
+    const auto *molI = i.molecule().get();
 
     // Get cell neighbours for atom i's cell
     auto &neighbours = cells.neighbours(*i.cell());
 
-    return dissolve::transform_reduce(ParallelPolicies::par, neighbours.begin(), neighbours.end(), 0.0, std::plus<>(),
-                                      [&i, this](const auto &neighbour)
-                                      {
-                                          auto mimRequired = neighbour.requiresMIM_;
-                                          auto &nbrCellAtoms = neighbour.neighbour_.atoms();
-                                          return std::accumulate(
-                                              nbrCellAtoms.begin(), nbrCellAtoms.end(), 0.0,
-                                              [&i, mimRequired, this](const auto innerAcc, const auto *j)
-                                              {
-                                                  auto &jj = *j;
-
-                                                  // Calculate rSquared distance between atoms, and check it against
-                                                  // the stored cutoff distance
-                                                  auto rSq = mimRequired ? box_->minimumDistanceSquared(i.r(), jj.r())
-                                                                         : (i.r() - jj.r()).magnitudeSq();
-                                                  if (rSq > cutoffDistanceSquared_)
-                                                      return innerAcc;
-
-                                                  // Check for atoms in the same species
-                                                  if (i.molecule().get() != jj.molecule().get())
-                                                      return innerAcc + pairPotentialEnergy(i, jj, sqrt(rSq));
-
-                                                  return innerAcc;
-                                              });
-                                      });
+    return dissolve::transform_reduce(
+        ParallelPolicies::par, neighbours.begin(), neighbours.end(), 0.0, std::plus<>(),
+        [&](const auto &neighbour)
+        {
+            auto begin = coords.cellBegin(neighbour.neighbour_.index()), end = coords.cellEnd(neighbour.neighbour_.index());
+
+            // Loop over neighbour cell atoms, excluding any in the same molecule (including atom i itself)
+            auto atomLoop = [&](const auto mim)
+            {
+                auto energy = 0.0;
+                for (auto j = begin; j < end; ++j)
+                {
+                    if (molI == molecules[j])
+                        continue;
+
+                    // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
+                    auto dx = x[j] - rI.x, dy = y[j] - rI.y, dz = z[j] - rI.z;
+                    mim.apply(dx, dy, dz);
+                    auto rSq = dx * dx + dy * dy + dz * dz;
+                    if (rSq > cutoffDistanceSquared_)
+                        continue;
+
+                    energy += pairPotentialEnergy(i, *atoms[j], sqrt(rSq));
+                }
+                return energy;
+            };
+            return neighbour.requiresMIM_ ? MinimumImage::dispatch(*box_, atomLoop) : atomLoop(MinimumImage::None());
+        });
 }
 
 // Return PairPotential energy of Molecule with world
@@ -227,6 +292,11 @@ PairPotentialEnergyValue EnergyKernel::pairPotentialEnergy(const Molecule &mol,
 {
     assert(cellArray_);
     auto &cells = cellArray_->get();
+    auto &coords = cells.coordinates();
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    const auto *molI = &mol;
 
     // Create a map of atoms in cells so we can treat all atoms with the same set of neighbours at once
     std::map<Cell *, std::vector<const Atom *>> locationMap;
@@ -244,58 +314,50 @@ PairPotentialEnergyValue EnergyKernel::pairPotentialEnergy(const Molecule &mol,
 
             auto localEnergy = dissolve::transform_reduce(
                 ParallelPolicies::par, neighbours.begin(), neighbours.end(), PairPotentialEnergyValue(), std::plus<>(),
-                [&centralCellAtoms, includeIntraMolecular, this](const auto &neighbour)
+                [&](const auto &neighbour)
                 {
-                    return std::accumulate(
-                        centralCellAtoms.begin(), centralCellAtoms.end(), PairPotentialEnergyValue(),
-                        [&neighbour, includeIntraMolecular, this](const auto acc, const auto &i)
+                    auto begin = coords.cellBegin(neighbour.neighbour_.index());
+                    auto end = coords.cellEnd(neighbour.neighbour_.index());
+
+                    // Loop over molecule atoms in the central cell and all atoms in the neighbour cell
+                    auto atomLoop = [&](const auto mim)
+                    {
+                        PairPotentialEnergyValue energy;
+                        for (const auto *i : centralCellAtoms)
                         {
-                            auto &ii = *i;
-                            auto mimRequired = neighbour.requiresMIM_;
-                            auto &nbrCellAtoms = neighbour.neighbour_.atoms();
-                            return acc +
-                                   std::accumulate(
-                                       nbrCellAtoms.begin(), nbrCellAtoms.end(), PairPotentialEnergyValue(),
-                                       [&ii, mimRequired, includeIntraMolecular, this](const auto innerAcc, const auto *j)
-                                       {
-                                           auto &jj = *j;
-
-                                           // Same molecule?
-                                           auto sameMol = ii.molecule().get() == jj.molecule().get();
-                                           if (sameMol)
-                                           {
-                                               if (!includeIntraMolecular)
-                                                   return innerAcc;
-                                               else if (&ii == &jj)
-                                                   return innerAcc;
-                                           }
-
-                                           // Calculate rSquared distance between atoms, and check it against
-                                           // the stored cutoff distance
-                                           auto rSq = mimRequired ? box_->minimumDistanceSquared(ii.r(), jj.r())
-                                                                  : (ii.r() - jj.r()).magnitudeSq();
-                                           if (rSq > cutoffDistanceSquared_)
-                                               return innerAcc;
-
-                                           // If the same molecule need to check scaling (other checks already made above)
-                                           if (sameMol)
-                                           {
-                                               auto &&[scalingType, elec14, vdw14] = ii.scaling(&jj);
-                                               if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
-                                                   return innerAcc +
-                                                          PairPotentialEnergyValue(0.0, pairPotentialEnergy(ii, jj, sqrt(rSq)));
-                                               else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
-                                                   return innerAcc +
-                                                          PairPotentialEnergyValue(
-                                                              0.0, pairPotentialEnergy(ii, jj, sqrt(rSq), elec14, vdw14));
-                                               else
-                                                   return innerAcc;
-                                           }
-                                           else
-                                               return innerAcc +
-                                                      PairPotentialEnergyValue(pairPotentialEnergy(ii, jj, sqrt(rSq)), 0.0);
-                                       });
-                        });
+                            const auto rI = i->r();
+                            for (auto j = begin; j < end; ++j)
+                            {
+                                // Same molecule?
+                                auto sameMol = molI == molecules[j];
+                                if (sameMol && (!includeIntraMolecular || i == atoms[j]))
+                                    continue;
+
+                                // Calculate rSquared distance between atoms, and check it against the stored cutoff distance
+                                auto dx = x[j] - rI.x, dy = y[j] - rI.y, dz = z[j] - rI.z;
+                                mim.apply(dx, dy, dz);
+                                auto rSq = dx * dx + dy * dy + dz * dz;
+                                if (rSq > cutoffDistanceSquared_)
+                                    continue;
+
+                                // If the same molecule need to check scaling (other checks already made above)
+                                if (sameMol)
+                                {
+                                    auto &&[scalingType, elec14, vdw14] = i->scaling(atoms[j]);
+                                    if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
+                                        energy.addIntraMolecular(pairPotentialEnergy(*i, *atoms[j], sqrt(rSq)));
+                                    else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
+                                        energy.addIntraMolecular(
+                                            pairPotentialEnergy(*i, *atoms[j], sqrt(rSq), elec14, vdw14));
+                                }
+                                else
+                                    energy.addInterMolecular(pairPotentialEnergy(*i, *atoms[j], sqrt(rSq)));
+                            }
+                        }
+                        return energy;
+                    };
+                    return neighbour.requiresMIM_ ? MinimumImage::dispatch(*box_, atomLoop)
+                                                  : atomLoop(MinimumImage::None());
                 });
 
             return totalAcc + localEnergy;
@@ -322,17 +384,39 @@ double EnergyKernel::extendedEnergy(const Molecule &mol) const { return 0.0; }
 PairPotentialEnergyValue EnergyKernel::totalPairPotentialEnergy(bool includeIntraMolecular,
                                                                 ProcessPool::DivisionStrategy strategy) const
 {
-    assert(cellArray_);
+    assert(cellArray_ && configuration_);
     auto &cells = cellArray_->get();
 
-    // List of cell neighbour pairs
-    auto &cellNeighbourPairs = cells.getCellNeighbourPairs();
-
     // Set start/stride for parallel loop
     auto offset = processPool_.interleavedLoopStart(strategy);
     auto nChunks = processPool_.interleavedLoopStride(strategy);
 
     PairPotentialEnergyValue ppEnergy;
+
+    // Use the neighbour list for intermolecular terms if we have one, adding intramolecular terms from individual molecules
+    if (neighbourList_)
+    {
+        auto &neighbourList = neighbourList_->get();
+        auto [begin, end] = chop_range(0, neighbourList.nOwners(), nChunks, offset);
+        ppEnergy += dissolve::transform_reduce(ParallelPolicies::par, dissolve::counting_iterator<int>(begin),
+                                               dissolve::counting_iterator<int>(end), PairPotentialEnergyValue(), std::plus<>(),
+                                               [&](const int n) { return neighbourListEnergy(neighbourList, n); });
+
+        if (includeIntraMolecular)
+        {
+            assert(molecules_);
+            auto [molBegin, molEnd] = chop_range(molecules_->get().begin(), molecules_->get().end(), nChunks, offset);
+            ppEnergy += dissolve::transform_reduce(ParallelPolicies::par, molBegin, molEnd, PairPotentialEnergyValue(),
+                                                   std::plus<>(), [&](const auto &mol) { return intraMolecularEnergy(*mol); });
+        }
+
+        return ppEnergy;
+    }
+
+    // List of cell neighbour pairs
+    auto &cellNeighbourPairs = cells.getCellNeighbourPairs();
+    auto &coords = configuration_->coordinateBlock();
+
     auto [begin, end] = chop_range(cellNeighbourPairs.begin(), cellNeighbourPairs.end(), nChunks, offset);
 
     ppEnergy += dissolve::transform_reduce(ParallelPolicies::par, begin, end, PairPotentialEnergyValue(), std::plus<>(),
@@ -342,9 +426,10 @@ PairPotentialEnergyValue EnergyKernel::totalPairPotentialEnergy(bool includeIntr
                                                auto &cellJ = pair.neighbour_;
                                                auto mimRequired = pair.requiresMIM_;
                                                if (&cellI == &cellJ)
-                                                   return cellEnergy(cellI, includeIntraMolecular);
+                                                   return cellEnergy(coords, cellI, includeIntraMolecular);
                                                else
-                                                   return cellToCellEnergy(cellI, cellJ, mimRequired, includeIntraMolecular);
+                                                   return cellToCellEnergy(coords, cellI, cellJ, mimRequired,
+                                                                           includeIntraMolecular);
                                            });
 
     return ppEnergy;
@@ -15,8 +15,10 @@ class Cell;
 class CellArray;
 class Box;
 class Configuration;
+class CoordinateBlock;
 class PotentialMap;
 class Molecule;
+class NeighbourList;
 class SpeciesBond;
 class SpeciesAngle;
 class SpeciesImproper;
@@ -73,7 +75,7 @@ class EnergyKernel : public GeometryKernel
     friend class KernelProducer;
     friend class ExternalPotentialsEnergyKernel;
     EnergyKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                 std::optional<double> energyCutoff = {});
+                 std::optional<double> energyCutoff = {}, OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
 
     public:
     ~EnergyKernel() = default;
@@ -92,10 +94,14 @@ class EnergyKernel : public GeometryKernel
      */
     private:
     // Return PairPotential energy of atoms in the supplied cell
-    PairPotentialEnergyValue cellEnergy(const Cell &cell, bool includeIntraMolecular) const;
+    PairPotentialEnergyValue cellEnergy(const CoordinateBlock &coords, const Cell &cell, bool includeIntraMolecular) const;
     // Return PairPotential energy between two cells
-    PairPotentialEnergyValue cellToCellEnergy(const Cell &cell, const Cell &otherCell, bool applyMim,
-                                              bool includeIntraMolecular) const;
+    PairPotentialEnergyValue cellToCellEnergy(const CoordinateBlock &coords, const Cell &cell, const Cell &otherCell,
+                                              bool applyMim, bool includeIntraMolecular) const;
+    // Return PairPotential energy between specified owning atom in neighbour list and its neighbours
+    PairPotentialEnergyValue neighbourListEnergy(const NeighbourList &neighbourList, int ownerIndex) const;
+    // Return intramolecular PairPotential energy of Molecule
+    PairPotentialEnergyValue intraMolecularEnergy(const Molecule &mol) const;
     // Return PairPotential energy of atom with world
     double pairPotentialEnergy(const Atom &i) const;
     // Return PairPotential energy of Molecule with world
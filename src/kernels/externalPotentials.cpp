@@ -11,8 +11,9 @@
 
 ExternalPotentialsEnergyKernel::ExternalPotentialsEnergyKernel(const Configuration *cfg, const ProcessPool &procPool,
                                                                const PotentialMap &potentialMap,
-                                                               std::optional<double> energyCutoff)
-    : EnergyKernel(cfg, procPool, potentialMap, energyCutoff), globalPotentials_(cfg->globalPotentials())
+                                                               std::optional<double> energyCutoff,
+                                                               OptionalReferenceWrapper<const NeighbourList> neighbourList)
+    : EnergyKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList), globalPotentials_(cfg->globalPotentials())
 {
 }
 
@@ -38,8 +39,9 @@ double ExternalPotentialsEnergyKernel::extendedEnergy(const Molecule &mol) const
 
 ExternalPotentialsForceKernel::ExternalPotentialsForceKernel(const Configuration *cfg, const ProcessPool &procPool,
                                                              const PotentialMap &potentialMap,
-                                                             std::optional<double> energyCutoff)
-    : ForceKernel(cfg, procPool, potentialMap, energyCutoff), globalPotentials_(cfg->globalPotentials())
+                                                             std::optional<double> energyCutoff,
+                                                             OptionalReferenceWrapper<const NeighbourList> neighbourList)
+    : ForceKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList), globalPotentials_(cfg->globalPotentials())
 {
 }
 
@@ -15,7 +15,8 @@ class ExternalPotentialsEnergyKernel : public EnergyKernel
     private:
     friend class KernelProducer;
     ExternalPotentialsEnergyKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                                   std::optional<double> energyCutoff = {});
+                                   std::optional<double> energyCutoff = {},
+                                   OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
 
     public:
     ~ExternalPotentialsEnergyKernel() = default;
@@ -43,7 +44,8 @@ class ExternalPotentialsForceKernel : public ForceKernel
     private:
     friend class KernelProducer;
     ExternalPotentialsForceKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                                  std::optional<double> energyCutoff = {});
+                                  std::optional<double> energyCutoff = {},
+                                  OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
 
     public:
     ~ExternalPotentialsForceKernel() = default;
@@ -2,18 +2,22 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "kernels/force.h"
+#include "classes/atomOwnership.h"
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
+#include "classes/coordinateBlock.h"
+#include "classes/minimumImage.h"
 #include "classes/molecule.h"
+#include "classes/neighbourList.h"
 #include "classes/potentialMap.h"
 #include "classes/species.h"
 #include "templates/algorithms.h"
 #include <iterator>
 
 ForceKernel::ForceKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                         std::optional<double> energyCutoff)
-    : GeometryKernel(cfg, procPool, potentialMap, energyCutoff)
+                         std::optional<double> energyCutoff, OptionalReferenceWrapper<const NeighbourList> neighbourList)
+    : GeometryKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList)
 {
 }
 
@@ -27,6 +31,18 @@ ForceKernel::ForceKernel(const Box *box, const ProcessPool &procPool, const Pote
  * Force Calculation
  */
 
+// Return intermolecular force between Atoms provided, accumulating energy and virial if requested
+double ForceKernel::interMolecularForce(const Atom &i, const Atom &j, double r, EnergyAndVirial *energyAndVirial) const
+{
+    if (!energyAndVirial)
+        return potentialMap_.force(i, j, r);
+
+    auto [energy, force] = potentialMap_.energyAndForce(i, j, r);
+    energyAndVirial->energy.addInterMolecular(energy);
+    energyAndVirial->virial += force * r;
+    return force;
+}
+
 // Calculate PairPotential forces between Atoms provided
 void ForceKernel::forcesWithoutMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f) const
 {
@@ -56,8 +72,9 @@ void ForceKernel::forcesWithoutMim(const Atom &i, int indexI, const Atom &j, int
     f[indexJ] += vij;
 }
 
-// Calculate PairPotential forces between Atoms provided
-void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f) const
+// Calculate PairPotential forces between Atoms provided, accumulating intramolecular energy and virial if requested
+void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f,
+                                EnergyAndVirial *energyAndVirial) const
 {
     auto vij = box_->minimumVector(i.r(), j.r());
     auto distanceSq = vij.magnitudeSq();
@@ -65,14 +82,23 @@ void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int in
         return;
     auto r = sqrt(distanceSq);
     vij /= r;
-    vij *= potentialMap_.force(i, j, r);
+    if (energyAndVirial)
+    {
+        auto [energy, force] = potentialMap_.energyAndForce(i, j, r);
+        energyAndVirial->energy.addIntraMolecular(energy);
+        energyAndVirial->virial += force * r;
+        vij *= force;
+    }
+    else
+        vij *= potentialMap_.force(i, j, r);
     f[indexI] -= vij;
     f[indexJ] += vij;
 }
 
-// Calculate inter-particle forces between Atoms provided, scaling electrostatic and van der Waals components
+// Calculate inter-particle forces between Atoms provided, scaling electrostatic and van der Waals components, and
+// accumulating intramolecular energy and virial if requested
 void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f, double elecScale,
-                                double srScale) const
+                                double srScale, EnergyAndVirial *energyAndVirial) const
 {
     auto vij = box_->minimumVector(i.r(), j.r());
     auto distanceSq = vij.magnitudeSq();
@@ -80,7 +106,15 @@ void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int in
         return;
     auto r = sqrt(distanceSq);
     vij /= r;
-    vij *= potentialMap_.force(i, j, r, elecScale, srScale);
+    if (energyAndVirial)
+    {
+        auto [energy, force] = potentialMap_.energyAndForce(i, j, r, elecScale, srScale);
+        energyAndVirial->energy.addIntraMolecular(energy);
+        energyAndVirial->virial += force * r;
+        vij *= force;
+    }
+    else
+        vij *= potentialMap_.force(i, j, r, elecScale, srScale);
     f[indexI] -= vij;
     f[indexJ] += vij;
 }
@@ -89,40 +123,110 @@ void ForceKernel::forcesWithMim(const Atom &i, int indexI, const Atom &j, int in
  * PairPotential Terms
  */
 
-// Calculate forces between atoms in supplied cells
-void ForceKernel::cellToCellPairPotentialForces(const Cell *centralCell, const Cell *otherCell, bool applyMim,
-                                                ForceVector &f) const
+// Calculate forces between atoms in supplied cell, excluding those within the same molecule
+void ForceKernel::cellPairPotentialForces(const CoordinateBlock &coords, const Cell *cell, ForceVector &f,
+                                          EnergyAndVirial *energyAndVirial) const
+{
+    assert(cell);
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    const auto *indices = coords.globalIndices();
+    auto begin = coords.cellBegin(cell->index()), end = coords.cellEnd(cell->index());
+
+    for (auto i = begin; i < end; ++i)
+    {
+        const auto *molI = molecules[i];
+        auto xi = x[i], yi = y[i], zi = z[i];
+
+        for (auto j = i + 1; j < end; ++j)
+        {
+            if (molI == molecules[j])
+                continue;
+
+            Vec3<double> vij(x[j] - xi, y[j] - yi, z[j] - zi);
+            auto distanceSq = vij.magnitudeSq();
+            if (distanceSq > cutoffDistanceSquared_)
+                continue;
+            auto r = sqrt(distanceSq);
+            vij *= interMolecularForce(*atoms[i], *atoms[j], r, energyAndVirial) / r;
+            f[indices[i]] -= vij;
+            f[indices[j]] += vij;
+        }
+    }
+}
+
+// Calculate forces between atoms in supplied cells, excluding those within the same molecule
+void ForceKernel::cellToCellPairPotentialForces(const CoordinateBlock &coords, const Cell *centralCell, const Cell *otherCell,
+                                                bool applyMim, ForceVector &f, EnergyAndVirial *energyAndVirial) const
 {
     assert(centralCell && otherCell);
-    auto &centralAtoms = centralCell->atoms();
-    auto &otherAtoms = otherCell->atoms();
-    std::shared_ptr<Molecule> molI;
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *atoms = coords.atoms();
+    const auto *molecules = coords.molecules();
+    const auto *indices = coords.globalIndices();
+    auto beginI = coords.cellBegin(centralCell->index()), endI = coords.cellEnd(centralCell->index());
+    auto beginJ = coords.cellBegin(otherCell->index()), endJ = coords.cellEnd(otherCell->index());
 
     // Loop over all atom pairs excluding any within the same molecule
-    if (applyMim)
+    auto pairLoop = [&](const auto mim)
     {
-        for (const auto &i : centralAtoms)
+        for (auto i = beginI; i < endI; ++i)
         {
-            molI = i->molecule();
-            auto indexI = molI->globalAtomIndex(i);
+            const auto *molI = molecules[i];
+            auto xi = x[i], yi = y[i], zi = z[i];
 
-            for (auto *j : otherAtoms)
-                if (molI != j->molecule())
-                    forcesWithMim(*i, indexI, *j, j->molecule()->globalAtomIndex(j), f);
+            for (auto j = beginJ; j < endJ; ++j)
+            {
+                if (molI == molecules[j])
+                    continue;
+
+                auto dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+                mim.apply(dx, dy, dz);
+                Vec3<double> vij(dx, dy, dz);
+                auto distanceSq = vij.magnitudeSq();
+                if (distanceSq > cutoffDistanceSquared_)
+                    continue;
+                auto r = sqrt(distanceSq);
+                vij *= interMolecularForce(*atoms[i], *atoms[j], r, energyAndVirial) / r;
+                f[indices[i]] -= vij;
+                f[indices[j]] += vij;
+            }
         }
-    }
+    };
+    if (applyMim)
+        MinimumImage::dispatch(*box_, pairLoop);
     else
-    {
-        for (const auto &i : centralAtoms)
-        {
-            molI = i->molecule();
-            auto indexI = molI->globalAtomIndex(i);
+        pairLoop(MinimumImage::None());
+}
 
-            for (auto *j : otherAtoms)
-                if (molI != j->molecule())
-                    forcesWithoutMim(*i, indexI, *j, j->molecule()->globalAtomIndex(j), f);
-        }
-    }
+// Calculate forces between specified owning atom in neighbour list and its neighbours
+void ForceKernel::neighbourListPairPotentialForces(const NeighbourList &neighbourList, int ownerIndex, ForceVector &f,
+                                                   EnergyAndVirial *energyAndVirial) const
+{
+    auto &atoms = configuration_->atoms();
+    auto indexI = neighbourList.owner(ownerIndex);
+    auto &i = atoms[indexI];
+
+    // Pairs are stored irrespective of their cell locations, so minimum image is always applied
+    MinimumImage::dispatch(*box_,
+                           [&](const auto mim)
+                           {
+                               std::for_each(neighbourList.neighboursBegin(ownerIndex),
+                                             neighbourList.neighboursEnd(ownerIndex),
+                                             [&](const auto indexJ)
+                                             {
+                                                 auto &j = atoms[indexJ];
+                                                 auto vij = MinimumImage::vector(mim, i.r(), j.r());
+                                                 auto distanceSq = vij.magnitudeSq();
+                                                 if (distanceSq > cutoffDistanceSquared_)
+                                                     return;
+                                                 auto r = sqrt(distanceSq);
+                                                 vij *= interMolecularForce(i, j, r, energyAndVirial) / r;
+                                                 f[indexI] -= vij;
+                                                 f[indexJ] += vij;
+                                             });
+                           });
 }
 
 /*
@@ -139,12 +243,14 @@ void ForceKernel::extendedForces(const Molecule &mol, ForceVector &f) const { re
  * Totals
  */
 
-// Calculate total forces in the world
+// Calculate total forces in the world, optionally returning the (process-local) pair potential energy and virial
 void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, ProcessPool::DivisionStrategy strategy,
-                              Flags<ForceCalculationFlags> flags) const
+                              Flags<ForceCalculationFlags> flags, OptionalReferenceWrapper<EnergyAndVirial> energyAndVirial,
+                              OptionalReferenceWrapper<const AtomOwnership> ownership) const
 {
     assert(molecules_);
     assert(cellArray_);
+    assert(configuration_);
 
     auto &molecules = molecules_->get();
     auto &cellArray = cellArray_->get();
@@ -156,9 +262,32 @@ void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, Proces
     auto combinableUnbound = createCombinableForces(fUnbound);
     auto combinableBound = createCombinableForces(fBound);
 
-    // Pair potential forces between different molecules
-    if (!flags.isSet(ExcludeInterMolecularPairPotential))
+    // Energy and virial are accumulated in the same sweep as the forces, but only if requested
+    dissolve::CombinableValue<EnergyAndVirial> combinableEnergyAndVirial(EnergyAndVirial{});
+    auto localEnergyAndVirial = [&]() { return energyAndVirial ? &combinableEnergyAndVirial.local() : nullptr; };
+
+    // Pair potential forces between different molecules, from the neighbour list if we have one
+    if (!flags.isSet(ExcludeInterMolecularPairPotential) && neighbourList_)
+    {
+        auto &neighbourList = neighbourList_->get();
+        auto [begin, end] = ownership ? std::make_tuple(0, neighbourList.nOwners())
+                                      : chop_range(0, neighbourList.nOwners(), stride, start);
+
+        // Force operator
+        auto unaryOp = [&](const int n)
+        {
+            if (ownership && !ownership->get().owns(neighbourList.owner(n)))
+                return;
+            neighbourListPairPotentialForces(neighbourList, n, combinableUnbound.local(), localEnergyAndVirial());
+        };
+
+        // Execute lambda operator for each owning atom
+        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(begin),
+                           dissolve::counting_iterator<int>(end), unaryOp);
+    }
+    else if (!flags.isSet(ExcludeInterMolecularPairPotential))
     {
+        auto &coords = configuration_->coordinateBlock();
         auto [begin, end] = chop_range(0, cellArray.nCells(), stride, start);
 
         // Force operator
@@ -166,30 +295,27 @@ void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, Proces
         {
             auto *cellI = cellArray.cell(id);
             auto &fLocal = combinableUnbound.local();
+            auto *evLocal = localEnergyAndVirial();
 
             // Interatomic interactions between atoms in this cell, excluding those within the same molecule
-            dissolve::for_each_pair(ParallelPolicies::seq, cellI->atoms().begin(), cellI->atoms().end(),
-                                    [&](int indexI, const auto &i, int indexJ, const auto &j)
-                                    {
-                                        if (indexI == indexJ)
-                                            return;
-                                        // Check for atoms in the same molecule
-                                        if (i->molecule() != j->molecule())
-                                            forcesWithoutMim(*i, i->globalIndex(), *j, j->globalIndex(), fLocal);
-                                    });
+            cellPairPotentialForces(coords, cellI, fLocal, evLocal);
 
             // Interatomic interactions between atoms in this cell and its neighbours
             auto &neighbours = cellArray_->get().neighbours(*cellI);
             for (auto it = std::next(neighbours.begin()); it != neighbours.end(); ++it)
             {
                 if (it->neighbour_.index() < cellI->index())
-                    cellToCellPairPotentialForces(cellI, &it->neighbour_, it->requiresMIM_, fLocal);
+                    cellToCellPairPotentialForces(coords, cellI, &it->neighbour_, it->requiresMIM_, fLocal, evLocal);
             }
         };
 
         // Execute lambda operator for each cell
-        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(begin),
-                           dissolve::counting_iterator<int>(end), unaryOp);
+        if (ownership)
+            dissolve::for_each(ParallelPolicies::par, ownership->get().ownedCells().begin(),
+                               ownership->get().ownedCells().end(), unaryOp);
+        else
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(begin),
+                               dissolve::counting_iterator<int>(end), unaryOp);
     }
 
     // Other molecule forces
@@ -197,8 +323,13 @@ void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, Proces
     {
         auto moleculeForceOperator = [&](const auto &mol)
         {
+            // Molecules belong to the owner of their first atom
+            if (ownership && !ownership->get().owns(mol->globalAtomOffset()))
+                return;
+
             auto &fLocalUnbound = combinableUnbound.local();
             auto &fLocalBound = combinableBound.local();
+            auto *evLocal = localEnergyAndVirial();
 
             auto offset = mol->globalAtomOffset();
 
@@ -215,10 +346,11 @@ void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, Proces
                                                 return;
                                             auto &&[scalingType, elec14, vdw14] = i->scaling(j);
                                             if (scalingType == SpeciesAtom::ScaledInteraction::NotScaled)
-                                                forcesWithMim(*i, offset + indexI, *j, offset + indexJ, fLocalUnbound);
+                                                forcesWithMim(*i, offset + indexI, *j, offset + indexJ, fLocalUnbound,
+                                                              evLocal);
                                             else if (scalingType == SpeciesAtom::ScaledInteraction::Scaled)
                                                 forcesWithMim(*i, offset + indexI, *j, offset + indexJ, fLocalUnbound, elec14,
-                                                              vdw14);
+                                                              vdw14, evLocal);
                                         });
 
             // Extended forces
@@ -226,10 +358,17 @@ void ForceKernel::totalForces(ForceVector &fUnbound, ForceVector &fBound, Proces
                 extendedForces(*mol.get(), fLocalUnbound);
         };
 
-        auto [begin, end] = chop_range(molecules.begin(), molecules.end(), stride, start);
-        dissolve::for_each(ParallelPolicies::par, begin, end, moleculeForceOperator);
+        if (ownership)
+            dissolve::for_each(ParallelPolicies::par, molecules.begin(), molecules.end(), moleculeForceOperator);
+        else
+        {
+            auto [begin, end] = chop_range(molecules.begin(), molecules.end(), stride, start);
+            dissolve::for_each(ParallelPolicies::par, begin, end, moleculeForceOperator);
+        }
     }
 
     combinableUnbound.finalize();
     combinableBound.finalize();
+    if (energyAndVirial)
+        energyAndVirial->get() = combinableEnergyAndVirial.finalize();
 }
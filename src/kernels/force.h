@@ -5,6 +5,7 @@
 
 #include "base/processPool.h"
 #include "classes/cellArray.h"
+#include "kernels/energy.h"
 #include "kernels/geometry.h"
 #include "templates/combinable.h"
 #include "templates/flags.h"
@@ -12,9 +13,12 @@
 
 // Forward Declarations
 class Atom;
+class AtomOwnership;
 class Box;
 class Cell;
 class Configuration;
+class CoordinateBlock;
+class NeighbourList;
 class PotentialMap;
 class Species;
 class SpeciesAngle;
@@ -29,7 +33,7 @@ class ForceKernel : public GeometryKernel
     friend class KernelProducer;
     friend class ExternalPotentialsForceKernel;
     ForceKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                std::optional<double> energyCutoff = {});
+                std::optional<double> energyCutoff = {}, OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     ForceKernel(const Box *box, const ProcessPool &procPool, const PotentialMap &potentialMap,
                 std::optional<double> energyCutoff = {});
 
@@ -42,22 +46,51 @@ class ForceKernel : public GeometryKernel
         return {parentForces, [&]() { return std::vector<Vec3<double>>(parentForces.size()); }};
     }
 
+    /*
+     * Energy and Virial
+     */
+    public:
+    // Pair potential energy and virial, accumulated alongside forces on request
+    struct EnergyAndVirial
+    {
+        // Pair potential energy
+        PairPotentialEnergyValue energy;
+        // Pair potential virial, the sum of r(ij) * f(ij) over all interacting pairs
+        double virial{0.0};
+
+        EnergyAndVirial operator+(const EnergyAndVirial &other) const
+        {
+            return {energy + other.energy, virial + other.virial};
+        }
+    };
+
     /*
      * PairPotential Terms
      */
     private:
+    // Return intermolecular force between Atoms provided, accumulating energy and virial if requested
+    double interMolecularForce(const Atom &i, const Atom &j, double r, EnergyAndVirial *energyAndVirial) const;
     // Calculate inter-particle forces between Atoms provided
     void forcesWithoutMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f) const;
     // Calculate inter-particle forces between Atoms provided, scaling electrostatic and van der Waals components
     void forcesWithoutMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f, double elecScale,
                           double srScale) const;
-    // Calculate inter-particle forces between Atoms provided
-    void forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f) const;
-    // Calculate inter-particle forces between Atoms provided, scaling electrostatic and van der Waals components
-    void forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f, double elecScale,
-                       double srScale) const;
+    // Calculate inter-particle forces between Atoms provided, accumulating intramolecular energy and virial if requested
+    void forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f,
+                       EnergyAndVirial *energyAndVirial = nullptr) const;
+    // Calculate inter-particle forces between Atoms provided, scaling electrostatic and van der Waals components, and
+    // accumulating intramolecular energy and virial if requested
+    void forcesWithMim(const Atom &i, int indexI, const Atom &j, int indexJ, ForceVector &f, double elecScale, double srScale,
+                       EnergyAndVirial *energyAndVirial = nullptr) const;
+    // Calculate forces between atoms within a single cell
+    void cellPairPotentialForces(const CoordinateBlock &coords, const Cell *cell, ForceVector &f,
+                                 EnergyAndVirial *energyAndVirial = nullptr) const;
     // Calculate forces between two cells
-    void cellToCellPairPotentialForces(const Cell *cell, const Cell *otherCell, bool applyMim, ForceVector &f) const;
+    void cellToCellPairPotentialForces(const CoordinateBlock &coords, const Cell *cell, const Cell *otherCell, bool applyMim,
+                                       ForceVector &f, EnergyAndVirial *energyAndVirial = nullptr) const;
+    // Calculate forces between specified owning atom in neighbour list and its neighbours
+    void neighbourListPairPotentialForces(const NeighbourList &neighbourList, int ownerIndex, ForceVector &f,
+                                          EnergyAndVirial *energyAndVirial = nullptr) const;
 
     /*
      * Extended Terms
@@ -82,7 +115,10 @@ class ForceKernel : public GeometryKernel
     };
 
     public:
-    // Calculate total forces in the world
+    // Calculate total forces in the world, optionally returning the (process-local) pair potential energy and virial
+    // If an ownership is supplied, work is divided by the cells owned by each process rather than by the strategy, with each
+    // interaction still calculated by exactly one process
     void totalForces(ForceVector &fUnbound, ForceVector &fBound, ProcessPool::DivisionStrategy strategy,
-                     Flags<ForceCalculationFlags> flags = {}) const;
+                     Flags<ForceCalculationFlags> flags = {}, OptionalReferenceWrapper<EnergyAndVirial> energyAndVirial = {},
+                     OptionalReferenceWrapper<const AtomOwnership> ownership = {}) const;
 };
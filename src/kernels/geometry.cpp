@@ -8,8 +8,8 @@
 #include "templates/algorithms.h"
 
 GeometryKernel::GeometryKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                               std::optional<double> energyCutoff)
-    : KernelBase(cfg, procPool, potentialMap, energyCutoff)
+                               std::optional<double> energyCutoff, OptionalReferenceWrapper<const NeighbourList> neighbourList)
+    : KernelBase(cfg, procPool, potentialMap, energyCutoff, neighbourList)
 {
 }
 
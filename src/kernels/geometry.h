@@ -20,7 +20,7 @@ class GeometryKernel : public KernelBase
 {
     public:
     GeometryKernel(const Configuration *cfg, const ProcessPool &procPool, const PotentialMap &potentialMap,
-                   std::optional<double> energyCutoff = {});
+                   std::optional<double> energyCutoff = {}, OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     GeometryKernel(const Box *box, const ProcessPool &procPool, const PotentialMap &potentialMap,
                    std::optional<double> energyCutoff = {});
     ~GeometryKernel() = default;
@@ -9,22 +9,26 @@
 
 // Create energy kernel for specified configuration
 std::unique_ptr<EnergyKernel> KernelProducer::energyKernel(const Configuration *cfg, const ProcessPool &procPool,
-                                                           const PotentialMap &potentialMap, std::optional<double> energyCutoff)
+                                                           const PotentialMap &potentialMap, std::optional<double> energyCutoff,
+                                                           OptionalReferenceWrapper<const NeighbourList> neighbourList)
 {
     if (!cfg->globalPotentials().empty() || !cfg->targetedPotentials().empty())
-        return std::unique_ptr<EnergyKernel>(new ExternalPotentialsEnergyKernel(cfg, procPool, potentialMap, energyCutoff));
+        return std::unique_ptr<EnergyKernel>(
+            new ExternalPotentialsEnergyKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList));
     else
-        return std::unique_ptr<EnergyKernel>(new EnergyKernel(cfg, procPool, potentialMap, energyCutoff));
+        return std::unique_ptr<EnergyKernel>(new EnergyKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList));
 }
 
 // Create force kernel for specified configuration
 std::unique_ptr<ForceKernel> KernelProducer::forceKernel(const Configuration *cfg, const ProcessPool &procPool,
-                                                         const PotentialMap &potentialMap, std::optional<double> energyCutoff)
+                                                         const PotentialMap &potentialMap, std::optional<double> energyCutoff,
+                                                         OptionalReferenceWrapper<const NeighbourList> neighbourList)
 {
     if (!cfg->globalPotentials().empty() || !cfg->targetedPotentials().empty())
-        return std::unique_ptr<ForceKernel>(new ExternalPotentialsForceKernel(cfg, procPool, potentialMap, energyCutoff));
+        return std::unique_ptr<ForceKernel>(
+            new ExternalPotentialsForceKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList));
     else
-        return std::unique_ptr<ForceKernel>(new ForceKernel(cfg, procPool, potentialMap, energyCutoff));
+        return std::unique_ptr<ForceKernel>(new ForceKernel(cfg, procPool, potentialMap, energyCutoff, neighbourList));
 }
 
 // Create force kernel using the specified Box
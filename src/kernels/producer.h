@@ -18,11 +18,12 @@ class KernelProducer
     public:
     // Create energy kernel for specified configuration
     static std::unique_ptr<EnergyKernel> energyKernel(const Configuration *cfg, const ProcessPool &procPool,
-                                                      const PotentialMap &potentialMap,
-                                                      std::optional<double> energyCutoff = {});
+                                                      const PotentialMap &potentialMap, std::optional<double> energyCutoff = {},
+                                                      OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     // Create force kernel for specified configuration
     static std::unique_ptr<ForceKernel> forceKernel(const Configuration *cfg, const ProcessPool &procPool,
-                                                    const PotentialMap &potentialMap, std::optional<double> energyCutoff = {});
+                                                    const PotentialMap &potentialMap, std::optional<double> energyCutoff = {},
+                                                    OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     // Create force kernel using the specified Box
     static std::unique_ptr<ForceKernel> forceKernel(const Box *box, const ProcessPool &procPool,
                                                     const PotentialMap &potentialMap, std::optional<double> energyCutoff = {});
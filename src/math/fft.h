@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include "math/constants.h"
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+/*
+ * Fast Fourier Transform
+ *
+ * Iterative radix-2 Cooley-Tukey transform of complex data whose length is a power of two. The forward transform computes
+ * X(k) = sum_n x(n) exp(-2 pi i n k / N), and the inverse uses the opposite sign without normalisation. Twiddle factors are
+ * supplied by the caller so that they may be generated once for repeated transforms of the same length.
+ */
+namespace FFT
+{
+// Return smallest power of two not less than n
+inline int paddedSize(int n)
+{
+    auto size = 1;
+    while (size < n)
+        size <<= 1;
+    return size;
+}
+
+// Return twiddle factors for transforms of the specified length
+inline std::vector<std::complex<double>> twiddles(int size)
+{
+    std::vector<std::complex<double>> result(size / 2);
+    for (auto j = 0; j < size / 2; ++j)
+        result[j] = std::polar(1.0, -2.0 * PI * j / size);
+    return result;
+}
+
+// Transform supplied data in place, using twiddle factors generated for its length
+inline void transform(std::vector<std::complex<double>> &data, const std::vector<std::complex<double>> &twiddles,
+                      bool inverse = false)
+{
+    const auto size = int(data.size());
+    assert(size == paddedSize(size) && int(twiddles.size()) == size / 2);
+
+    // Bit-reversal permutation
+    for (auto i = 1, j = 0; i < size; ++i)
+    {
+        auto bit = size >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(data[i], data[j]);
+    }
+
+    // Butterflies, doubling the sub-transform length at each stage
+    for (auto length = 2; length <= size; length <<= 1)
+    {
+        const auto half = length / 2, stride = size / length;
+        for (auto start = 0; start < size; start += length)
+            for (auto j = 0; j < half; ++j)
+            {
+                const auto w = inverse ? std::conj(twiddles[j * stride]) : twiddles[j * stride];
+                const auto u = data[start + j], v = data[start + j + half] * w;
+                data[start + j] = u + v;
+                data[start + j + half] = u - v;
+            }
+    }
+}
+} // namespace FFT
@@ -3,22 +3,29 @@
 
 #include "math/ft.h"
 #include "math/data1D.h"
+#include "math/fft.h"
 #include "templates/algorithms.h"
 #include "templates/parallelDefs.h"
 #include <algorithm>
-#include <functional>
+#include <cassert>
+#include <cmath>
+#include <list>
+#include <mutex>
 #include <numeric>
-#include <vector>
 
 namespace Fourier
 {
-// Perform Fourier sine transform of current distribution function, over range specified, and with specified broadening
-// function, modification function, and window applied (if requested)
-bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax, WindowFunction windowFunction,
-            const Function1DWrapper &broadening)
+/*
+ * Sine Transform Plan
+ */
+
+SineTransformPlan::SineTransformPlan(const Data1D &source, double wMin, double wStep, double wMax,
+                                     WindowFunction windowFunction, const Function1DWrapper &broadening)
+    : x_(source.xAxis()), wMin_(wMin), wStep_(wStep), wMax_(wMax), windowForm_(windowFunction.form()),
+      broadeningForm_(broadening.form()), broadeningParameters_(broadening.parameters())
 {
     /*
-     * Perform sine Fourier transform of current data. Function has no notion of forward or backwards transforms -
+     * Generate the kernel of a sine Fourier transform. The transform has no notion of forward or backwards transforms -
      * normalisation and broadening functions must be suitable for the required purpose. Broadening functions are applied to
      * the transformed function utilising convolution theorem:
      *
@@ -28,92 +35,267 @@ bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double w
      * 	FT[ f(x) * g(x) ] = F(q) . G(q)
      * 	FT[ f(x) . g(x) ] = F(q) * G(q)
      *
-     * Since the ultimate goal of this function is to generate the broadened FT of the input data (with the broadening
+     * Since the ultimate goal of the transform is to generate the broadened FT of the input data (with the broadening
      * applied to the transformed data, rather than applied to the input data and then transformed) we require the first
      * case listed above. The quantity we want is the pointwise multiplication of the FT of the input data with the
      * broadening functions given, so we can simply perform the convolution of the input data with the *FT* of the
      * broadening functions, and FT the result.
+     *
+     * Each kernel element combines the quadrature weight x(i) * (x(i+1) - x(i)), the sine term (normalised w.r.t. omega), the
+     * window function, and the broadening function for one source point and one target point, none of which depend on the
+     * source values.
      */
 
     // Set up window function for the present data
-    windowFunction.setUp(data);
-
-    // Grab x and y arrays
-    const auto &x = data.xAxis();
-    const auto &y = data.values();
+    windowFunction.setUp(source);
 
-    // Create working arrays
-    std::vector<double> newX((wMax - wMin) / wStep);
-    std::iota(newX.begin(), newX.end(), 0);
-    dissolve::transform(ParallelPolicies::par, newX.begin(), newX.end(), newX.begin(),
+    // Create target abscissa
+    w_.resize((wMax - wMin) / wStep);
+    std::iota(w_.begin(), w_.end(), 0);
+    dissolve::transform(ParallelPolicies::par, w_.begin(), w_.end(), w_.begin(),
                         [wMin, wStep](const auto idx) { return wMin + idx * wStep; });
 
-    std::vector<double> newY(newX.size());
+    if (x_.size() < 2)
+        return;
+
+    // Determine quadrature weights for each contributing source point
+    nContributing_ = x_.size() - 1;
+    std::vector<double> weights(nContributing_);
+    for (auto i = 0; i < nContributing_; ++i)
+        weights[i] = x_[i] * (x_[i + 1] - x_[i]);
+
+    // Use the chirp-z method if we can
+    if (setUpChirpZ(weights, windowFunction, broadening))
+    {
+        method_ = Method::ChirpZ;
+        return;
+    }
+
+    // Generate kernel rows
+    const auto applyBroadening = broadeningForm_ != Functions1D::Form::None;
+    kernel_.resize(w_.size() * nContributing_);
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(w_.size()),
+                       [&](const auto row)
+                       {
+                           const auto omega = w_[row];
+                           auto *k = kernel_.data() + row * nContributing_;
+                           for (auto i = 0; i < nContributing_; ++i)
+                           {
+                               const auto x = x_[i];
+                               k[i] = weights[i] * windowFunction.y(x, omega);
+                               if (omega > 0.0)
+                                   k[i] *= sin(x * omega) / omega;
+                               if (applyBroadening)
+                                   k[i] *= broadening.yFT(x, omega);
+                           }
+                       });
+}
+
+// Set up chirp-z transform from the supplied quadrature weights, returning false if the method is not suitable
+bool SineTransformPlan::setUpChirpZ(const std::vector<double> &weights, const WindowFunction &windowFunction,
+                                    const Function1DWrapper &broadening)
+{
+    /*
+     * For a uniform source abscissa x(i) = x0 + i dx and target abscissa w(k) = wMin + k dw, the sine transform is the
+     * imaginary part of
+     *
+     * 	exp(i x0 w(k)) sum_i f(i) exp(i i dx wMin) z^(ik),  z = exp(i dx dw)
+     *
+     * where f(i) contains the source values and all omega-independent weights. Writing ik = (i^2 + k^2 - (k-i)^2) / 2 turns the
+     * sum into a convolution with the chirp z^(-n^2/2), which is evaluated with FFTs for all k at once. The result is exact on
+     * the requested target abscissa, so no interpolation is required.
+     */
+
+    const auto nTargets = int(w_.size());
+    if (nTargets == 0 || wStep_ <= 0.0)
+        return false;
 
-    std::vector<double> deltas(x.size()), product(x.size() - 1);
-    std::adjacent_difference(x.begin(), x.end(), deltas.begin());
-    dissolve::transform(ParallelPolicies::par, x.begin(), x.end() - 1, y.begin(), product.begin(),
-                        [](auto x, auto y) { return x * y; });
-    dissolve::transform(ParallelPolicies::par, product.begin(), product.end(), deltas.begin() + 1, product.begin(),
-                        std::multiplies());
+    // Check that the FFT route will be cheaper than the kernel
+    const auto fftSize = FFT::paddedSize(nContributing_ + nTargets - 1);
+    if (double(nContributing_) * nTargets < 5.0 * fftSize * log2(fftSize))
+        return false;
 
-    // Perform Fourier sine transform, apply general and omega-dependent broadening (if requested), as well as window function
-    if (broadening.form() != Functions1D::Form::None)
+    // Source abscissa must be uniform
+    const auto x0 = x_.front(), dx = x_[1] - x_[0];
+    for (auto i = 0; i < int(x_.size()); ++i)
+        if (fabs(x_[i] - (x0 + i * dx)) > 1.0e-8 * dx)
+            return false;
+
+    // Broadening must not depend on omega (window functions never do)
+    static const std::vector<Functions1D::Form> omegaIndependentForms = {
+        Functions1D::Form::None, Functions1D::Form::Gaussian, Functions1D::Form::ScaledGaussian};
+    if (std::find(omegaIndependentForms.begin(), omegaIndependentForms.end(), broadeningForm_) == omegaIndependentForms.end())
+        return false;
+    const auto applyBroadening = broadeningForm_ != Functions1D::Form::None;
+    sourceWeights_.resize(nContributing_);
+    for (auto i = 0; i < nContributing_; ++i)
     {
-        // Broadening
-        dissolve::transform(ParallelPolicies::par, newX.begin(), newX.end(), newY.begin(),
-                            [normFactor, &product, &x, &windowFunction, &broadening](const auto omega)
-                            {
-                                double ft = 0.0;
-
-                                if (omega > 0.0)
-                                    ft = std::transform_reduce(
-                                        product.begin(), product.end(), x.begin(), 0.0, std::plus(),
-                                        [omega, &windowFunction, &broadening](const auto r, const auto x)
-                                        { return r * sin(x * omega) * windowFunction.y(x, omega) * broadening.yFT(x, omega); });
-                                else
-                                    ft = std::transform_reduce(
-                                        product.begin(), product.end(), x.begin(), 0.0, std::plus(),
-                                        [omega, &windowFunction, &broadening](const auto r, const auto x)
-                                        { return r * windowFunction.y(x, omega) * broadening.yFT(x, omega); });
-
-                                // Normalise w.r.t. omega
-                                if (omega > 0.0)
-                                    ft /= omega;
-
-                                // Add point
-                                return ft * normFactor;
-                            });
+        const auto x = x_[i];
+        sourceWeights_[i] = weights[i] * windowFunction.y(x, w_.front());
+        if (applyBroadening)
+            sourceWeights_[i] *= broadening.yFT(x, w_.front());
     }
-    else
+
+    // Generate chirp factors, folding the normalisation of the inverse FFT into those applied to the target
+    const auto theta = dx * wStep_;
+    sourceChirp_.resize(nContributing_);
+    for (auto i = 0; i < nContributing_; ++i)
+        sourceChirp_[i] = std::polar(sourceWeights_[i], i * dx * wMin_ + 0.5 * theta * double(i) * i);
+    targetChirp_.resize(nTargets);
+    for (auto k = 0; k < nTargets; ++k)
+        targetChirp_[k] = std::polar(1.0 / fftSize, x0 * w_[k] + 0.5 * theta * double(k) * k);
+
+    // Generate chirp filter, wrapping negative offsets to the end of the array, and transform it
+    twiddles_ = FFT::twiddles(fftSize);
+    filter_.assign(fftSize, 0.0);
+    for (auto n = 0; n < nTargets; ++n)
+        filter_[n] = std::polar(1.0, -0.5 * theta * double(n) * n);
+    for (auto n = 1; n < nContributing_; ++n)
+        filter_[fftSize - n] = std::polar(1.0, -0.5 * theta * double(n) * n);
+    FFT::transform(filter_, twiddles_);
+
+    return true;
+}
+
+// Transform single source using the chirp-z method
+void SineTransformPlan::transformChirpZ(const double *y, double *dest, double normFactor) const
+{
+    std::vector<std::complex<double>> work(filter_.size(), 0.0);
+    for (auto i = 0; i < nContributing_; ++i)
+        work[i] = sourceChirp_[i] * y[i];
+
+    // Convolve with the chirp filter
+    FFT::transform(work, twiddles_);
+    std::transform(work.begin(), work.end(), filter_.begin(), work.begin(), std::multiplies());
+    FFT::transform(work, twiddles_, true);
+
+    for (auto k = 0; k < int(w_.size()); ++k)
     {
-        // No broadening
-        dissolve::transform(ParallelPolicies::par, newX.begin(), newX.end(), newY.begin(),
-                            [normFactor, &product, &x, &windowFunction](const auto omega)
-                            {
-                                double ft = 0.0;
-
-                                if (omega > 0.0)
-                                    ft = std::transform_reduce(product.begin(), product.end(), x.begin(), 0.0, std::plus(),
-                                                               [omega, &windowFunction](const auto r, const auto x)
-                                                               { return r * sin(x * omega) * windowFunction.y(x, omega); });
-                                else
-                                    ft = std::transform_reduce(product.begin(), product.end(), x.begin(), 0.0, std::plus(),
-                                                               [omega, &windowFunction](const auto r, const auto x)
-                                                               { return r * windowFunction.y(x, omega); });
-
-                                // Normalise w.r.t. omega
-                                if (omega > 0.0)
-                                    ft /= omega;
-
-                                // Add point
-                                return ft * normFactor;
-                            });
+        const auto omega = w_[k];
+        if (omega > 0.0)
+            dest[k] = (targetChirp_[k] * work[k]).imag() / omega * normFactor;
+        else
+            dest[k] = std::inner_product(sourceWeights_.begin(), sourceWeights_.end(), y, 0.0) * normFactor;
     }
+}
+
+// Return whether the plan applies to the specified source abscissa, target range, window, and broadening
+bool SineTransformPlan::matches(const std::vector<double> &x, double wMin, double wStep, double wMax,
+                                const WindowFunction &windowFunction, const Function1DWrapper &broadening) const
+{
+    return wMin == wMin_ && wStep == wStep_ && wMax == wMax_ && windowFunction.form() == windowForm_ &&
+           broadening.form() == broadeningForm_ && broadening.parameters() == broadeningParameters_ && x == x_;
+}
+
+// Return source abscissa
+const std::vector<double> &SineTransformPlan::x() const { return x_; }
+
+// Return target abscissa
+const std::vector<double> &SineTransformPlan::w() const { return w_; }
+
+// Return method used to perform transforms
+SineTransformPlan::Method SineTransformPlan::method() const { return method_; }
+
+// Transform source values into the supplied destination, which must already be sized to the target abscissa
+void SineTransformPlan::transform(const std::vector<double> &y, std::vector<double> &dest, double normFactor) const
+{
+    assert(y.size() == x_.size() && dest.size() == w_.size());
+
+    transform(std::vector<const double *>{y.data()}, std::vector<double *>{dest.data()}, normFactor);
+}
+
+// Transform multiple source value arrays into their corresponding destinations in a single pass over the kernel
+void SineTransformPlan::transform(const std::vector<const double *> &ys, const std::vector<double *> &dests,
+                                  double normFactor) const
+{
+    assert(ys.size() == dests.size());
+
+    if (method_ == Method::ChirpZ)
+    {
+        dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                           dissolve::counting_iterator<int>(ys.size()),
+                           [&](const auto n) { transformChirpZ(ys[n], dests[n], normFactor); });
+        return;
+    }
+
+    // Work over blocks of kernel rows and sources, so that both remain in cache while every pairing within them is formed
+    constexpr auto rowBlockSize = 16, sourceBlockSize = 8;
+    const auto nRows = int(w_.size()), nSources = int(ys.size());
+    dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                       dissolve::counting_iterator<int>((nRows + rowBlockSize - 1) / rowBlockSize),
+                       [&](const auto rowBlock)
+                       {
+                           const auto rowBegin = rowBlock * rowBlockSize, rowEnd = std::min(rowBegin + rowBlockSize, nRows);
+                           for (auto sourceBegin = 0; sourceBegin < nSources; sourceBegin += sourceBlockSize)
+                           {
+                               const auto sourceEnd = std::min(sourceBegin + sourceBlockSize, nSources);
+                               for (auto row = rowBegin; row < rowEnd; ++row)
+                               {
+                                   const auto *k = kernel_.data() + row * nContributing_;
+                                   for (auto n = sourceBegin; n < sourceEnd; ++n)
+                                       dests[n][row] = std::inner_product(k, k + nContributing_, ys[n], 0.0) * normFactor;
+                               }
+                           }
+                       });
+}
+
+// Return a (cached) sine transform plan for the supplied source data, target range, window, and broadening
+std::shared_ptr<const SineTransformPlan> sineTransformPlan(const Data1D &source, double wMin, double wStep, double wMax,
+                                                           const WindowFunction &windowFunction,
+                                                           const Function1DWrapper &broadening)
+{
+    // Most recently used plans, first to last
+    static std::list<std::shared_ptr<const SineTransformPlan>> plans;
+    static std::mutex plansMutex;
+    constexpr auto maxPlans = 8;
+
+    auto findPlan = [&]()
+    {
+        auto it = std::find_if(plans.begin(), plans.end(),
+                               [&](const auto &plan)
+                               { return plan->matches(source.xAxis(), wMin, wStep, wMax, windowFunction, broadening); });
+        if (it == plans.end())
+            return std::shared_ptr<const SineTransformPlan>();
+        plans.splice(plans.begin(), plans, it);
+        return plans.front();
+    };
+
+    {
+        std::scoped_lock lock(plansMutex);
+        if (auto plan = findPlan())
+            return plan;
+    }
+
+    // Generate the plan outside of the lock - construction is itself parallel, and may run other transforms in nested tasks
+    auto newPlan = std::make_shared<const SineTransformPlan>(source, wMin, wStep, wMax, windowFunction, broadening);
+
+    std::scoped_lock lock(plansMutex);
+    if (auto plan = findPlan())
+        return plan;
+    plans.push_front(newPlan);
+    if (plans.size() > maxPlans)
+        plans.pop_back();
+
+    return newPlan;
+}
+
+/*
+ * Transforms
+ */
+
+// Perform Fourier sine transform of current distribution function, over range specified, and with specified broadening
+// function, modification function, and window applied (if requested)
+bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax, WindowFunction windowFunction,
+            const Function1DWrapper &broadening)
+{
+    auto plan = sineTransformPlan(data, wMin, wStep, wMax, windowFunction, broadening);
+
+    std::vector<double> newY(plan->w().size());
+    plan->transform(data.values(), newY, normFactor);
 
     // Transfer working arrays to this object
-    data.xAxis() = newX;
-    data.values() = newY;
+    data.xAxis() = plan->w();
+    data.values() = std::move(newY);
 
     return true;
 }
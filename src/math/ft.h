@@ -5,6 +5,9 @@
 
 #include "math/function1D.h"
 #include "math/windowFunction.h"
+#include <complex>
+#include <memory>
+#include <vector>
 
 // Forward Declarations
 class Data1D;
@@ -12,6 +15,82 @@ class Data1D;
 // Fourier Transforms
 namespace Fourier
 {
+/*
+ * Sine Transform Plan
+ *
+ * Holds the combined kernel (sine, window, broadening, and quadrature weights) of a sine Fourier transform between a fixed
+ * source abscissa and a fixed target range, so that transforming data on that abscissa reduces to a matrix-vector product.
+ * Where the source abscissa is uniform and the broadening does not depend on omega, the transform is instead evaluated
+ * exactly on the target range by a chirp-z (Bluestein) transform built on FFTs, if that is expected to be cheaper.
+ */
+class SineTransformPlan
+{
+    public:
+    // Transform Methods
+    enum class Method
+    {
+        Kernel, /* Direct product with precalculated kernel matrix */
+        ChirpZ  /* Chirp-z transform via FFTs */
+    };
+    SineTransformPlan(const Data1D &source, double wMin, double wStep, double wMax, WindowFunction windowFunction,
+                      const Function1DWrapper &broadening);
+    ~SineTransformPlan() = default;
+    SineTransformPlan(const SineTransformPlan &) = delete;
+    SineTransformPlan &operator=(const SineTransformPlan &) = delete;
+
+    private:
+    // Source abscissa
+    std::vector<double> x_;
+    // Target range
+    double wMin_, wStep_, wMax_;
+    // Window function form
+    WindowFunction::Form windowForm_;
+    // Broadening function form and parameters
+    Functions1D::Form broadeningForm_;
+    std::vector<double> broadeningParameters_;
+    // Target abscissa
+    std::vector<double> w_;
+    // Number of source points contributing to each target point (length of kernel rows)
+    int nContributing_{0};
+    // Method used to perform transforms
+    Method method_{Method::Kernel};
+    // Kernel matrix (row-major, one row per target abscissa value)
+    std::vector<double> kernel_;
+    // Source weights including window and broadening
+    std::vector<double> sourceWeights_;
+    // Twiddle factors for FFTs
+    std::vector<std::complex<double>> twiddles_;
+    // Chirp factors applied to the source and target data, and FFT of the chirp filter
+    std::vector<std::complex<double>> sourceChirp_, targetChirp_, filter_;
+
+    private:
+    // Set up chirp-z transform from the supplied quadrature weights, returning false if the method is not suitable
+    bool setUpChirpZ(const std::vector<double> &weights, const WindowFunction &windowFunction,
+                     const Function1DWrapper &broadening);
+    // Transform single source using the chirp-z method
+    void transformChirpZ(const double *y, double *dest, double normFactor) const;
+
+    public:
+    // Return whether the plan applies to the specified source abscissa, target range, window, and broadening
+    bool matches(const std::vector<double> &x, double wMin, double wStep, double wMax, const WindowFunction &windowFunction,
+                 const Function1DWrapper &broadening) const;
+    // Return source abscissa
+    const std::vector<double> &x() const;
+    // Return target abscissa
+    const std::vector<double> &w() const;
+    // Return method used to perform transforms
+    Method method() const;
+    // Transform source values into the supplied destination, which must already be sized to the target abscissa
+    void transform(const std::vector<double> &y, std::vector<double> &dest, double normFactor) const;
+    // Transform multiple source value arrays into their corresponding destinations in a single pass over the kernel
+    void transform(const std::vector<const double *> &ys, const std::vector<double *> &dests, double normFactor) const;
+};
+
+// Return a (cached) sine transform plan for the supplied source data, target range, window, and broadening
+std::shared_ptr<const SineTransformPlan> sineTransformPlan(const Data1D &source, double wMin, double wStep, double wMax,
+                                                           const WindowFunction &windowFunction,
+                                                           const Function1DWrapper &broadening);
+
 // Perform Fourier sine transform of supplied data, over range specified, and with specified window and broadening
 // functions applied
 bool sineFT(Data1D &data, double normFactor, double wMin, double wStep, double wMax,
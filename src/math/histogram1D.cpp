@@ -112,8 +112,12 @@ int Histogram1D::nBins() const { return nBins_; }
 bool Histogram1D::bin(double x)
 {
     // Calculate target bin
-    auto bin = int((x - minimum_) / binWidth_);
+    return binIndex(int((x - minimum_) / binWidth_));
+}
 
+// Increment specified bin index (as calculated externally from the minimum and bin width), returning success
+bool Histogram1D::binIndex(int bin)
+{
     // Check bin range
     if ((bin < 0) || (bin >= nBins_))
     {
@@ -127,6 +131,22 @@ bool Histogram1D::bin(double x)
     return true;
 }
 
+// Decrement specified bin index (as calculated externally from the minimum and bin width), returning success
+bool Histogram1D::unbinIndex(int bin)
+{
+    // Check bin range
+    if ((bin < 0) || (bin >= nBins_))
+    {
+        --nMissed_;
+        return false;
+    }
+
+    --bins_[bin];
+    --nBinned_;
+
+    return true;
+}
+
 // Return number of values binned over all bins
 long int Histogram1D::nBinned() const { return nBinned_; }
 
@@ -62,6 +62,10 @@ class Histogram1D
     int nBins() const;
     // Bin specified value, returning success
     bool bin(double x);
+    // Increment specified bin index (as calculated externally from the minimum and bin width), returning success
+    bool binIndex(int bin);
+    // Decrement specified bin index (as calculated externally from the minimum and bin width), returning success
+    bool unbinIndex(int bin);
     // Return number of values binned over all bins
     long int nBinned() const;
     // Accumulate current histogram bins into averages
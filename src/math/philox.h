@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/*
+ * Philox4x32-10 Counter-Based Random Number Generator
+ *
+ * Maps a 128-bit counter and 64-bit key to 128 random bits through ten rounds of multiply / xor mixing (Salmon et al.,
+ * "Parallel Random Numbers: As Easy as 1, 2, 3", SC11). There is no internal state, so any number of independent streams can
+ * be produced without communication simply by assigning each a distinct key or counter range.
+ */
+namespace Philox
+{
+using Counter = std::array<uint32_t, 4>;
+using Key = std::array<uint32_t, 2>;
+
+// Return random bits for the specified counter and key
+inline Counter generate(Counter ctr, Key key)
+{
+    constexpr uint32_t multiplier0 = 0xD2511F53, multiplier1 = 0xCD9E8D57;
+    constexpr uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+
+    for (auto round = 0; round < 10; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+        auto product0 = uint64_t(multiplier0) * ctr[0];
+        auto product1 = uint64_t(multiplier1) * ctr[2];
+        ctr = {uint32_t(product1 >> 32) ^ ctr[1] ^ key[0], uint32_t(product1), uint32_t(product0 >> 32) ^ ctr[3] ^ key[1],
+               uint32_t(product0)};
+    }
+
+    return ctr;
+}
+
+// Convert random bits to a double in the range [0,1)
+inline double toUnitDouble(uint32_t bits) { return bits * (1.0 / 4294967296.0); }
+} // namespace Philox
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "math/potentialTable.h"
+#include "math/data1D.h"
+#include <cassert>
+
+// Clear all data
+void PotentialTable::clear()
+{
+    intervals_.clear();
+    intervals_.resize(1);
+    lastInterval_ = 0;
+    rDelta_ = 0.0;
+}
+
+/*
+ * Data
+ */
+
+// Generate from supplied energy and derivative data, reproducing three-point interpolation
+void PotentialTable::generate(const Data1D &energy, const Data1D &derivative, double delta)
+{
+    assert(energy.nValues() == derivative.nValues());
+
+    clear();
+    rDelta_ = 1.0 / delta;
+
+    const auto nValues = energy.nValues();
+    if (nValues == 0)
+        return;
+
+    /*
+     * Three-point interpolation over the interval starting at point k, with fractional position p, is:
+     *
+     *   y(p) = y(k) + p * (y(k+1) - y(k)) + 0.5 * p * (p - 1) * (y(k+2) - 2 y(k+1) + y(k))
+     *
+     * which is quadratic in p. Beyond the last three points the final value is returned. Forces are the negative of the
+     * supplied derivative.
+     */
+    auto coefficients = [](const std::vector<double> &y, int k, double factor)
+    {
+        auto d2 = y[k + 2] - 2.0 * y[k + 1] + y[k];
+        return std::array<double, 4>{factor * y[k], factor * (y[k + 1] - y[k] - 0.5 * d2), factor * 0.5 * d2, 0.0};
+    };
+    const auto nInterpolated = std::max(nValues - 3, 0);
+    intervals_.resize(nInterpolated + 1);
+    for (auto k = 0; k < nInterpolated; ++k)
+    {
+        intervals_[k].energy = coefficients(energy.values(), k, 1.0);
+        intervals_[k].force = coefficients(derivative.values(), k, -1.0);
+    }
+    intervals_.back().energy = {energy.values().back(), 0.0, 0.0, 0.0};
+    intervals_.back().force = {-derivative.values().back(), 0.0, 0.0, 0.0};
+    lastInterval_ = nInterpolated;
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+// Forward Declarations
+class Data1D;
+
+// Potential Table - immutable lookup of energy and force tabulated on a uniform grid starting at zero
+class PotentialTable
+{
+    public:
+    PotentialTable() = default;
+    ~PotentialTable() = default;
+    // Clear all data
+    void clear();
+
+    /*
+     * Data
+     */
+    public:
+    // Polynomial coefficients for energy and force over a single interval, in powers of the fractional position within it
+    struct alignas(64) Interval
+    {
+        std::array<double, 4> energy{}, force{};
+    };
+
+    private:
+    // Intervals, with the last extending to infinity
+    std::vector<Interval> intervals_ = std::vector<Interval>(1);
+    // Index of last interval
+    int lastInterval_{0};
+    // Reciprocal of grid spacing
+    double rDelta_{0.0};
+
+    public:
+    // Generate from supplied energy and derivative data, reproducing three-point interpolation
+    void generate(const Data1D &energy, const Data1D &derivative, double delta);
+    // Return intervals
+    const std::vector<Interval> &intervals() const { return intervals_; }
+    // Return index of last interval
+    int lastInterval() const { return lastInterval_; }
+    // Return reciprocal of grid spacing
+    double rDelta() const { return rDelta_; }
+
+    /*
+     * Evaluation
+     */
+    private:
+    // Evaluate polynomial at specified fractional position
+    static double evaluate(const std::array<double, 4> &c, double p) { return c[0] + p * (c[1] + p * (c[2] + p * c[3])); }
+
+    public:
+    // Return energy at specified distance from the supplied intervals
+    static double energy(const Interval *intervals, int lastInterval, double rDelta, double r)
+    {
+        auto x = r * rDelta;
+        auto index = std::min(int(x), lastInterval);
+        return evaluate(intervals[index].energy, x - index);
+    }
+    // Return force at specified distance from the supplied intervals
+    static double force(const Interval *intervals, int lastInterval, double rDelta, double r)
+    {
+        auto x = r * rDelta;
+        auto index = std::min(int(x), lastInterval);
+        return evaluate(intervals[index].force, x - index);
+    }
+    // Return energy and force at specified distance from the supplied intervals
+    static std::pair<double, double> energyAndForce(const Interval *intervals, int lastInterval, double rDelta, double r)
+    {
+        auto x = r * rDelta;
+        auto index = std::min(int(x), lastInterval);
+        const auto &interval = intervals[index];
+        return {evaluate(interval.energy, x - index), evaluate(interval.force, x - index)};
+    }
+    // Return energy at specified distance
+    double energy(double r) const { return energy(intervals_.data(), lastInterval_, rDelta_, r); }
+    // Return force at specified distance
+    double force(double r) const { return force(intervals_.data(), lastInterval_, rDelta_, r); }
+    // Return energy and force at specified distance
+    std::pair<double, double> energyAndForce(double r) const
+    {
+        return energyAndForce(intervals_.data(), lastInterval_, rDelta_, r);
+    }
+};
@@ -1,16 +1,18 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "base/timer.h"
 #include "classes/box.h"
 #include "classes/changeStore.h"
 #include "classes/configuration.h"
+#include "classes/domainDecomposition.h"
 #include "classes/regionalDistributor.h"
 #include "kernels/producer.h"
 #include "main/dissolve.h"
 #include "module/context.h"
 #include "modules/atomShake/atomShake.h"
+#include "templates/algorithms.h"
 
 // Run main processing
 Module::ExecutionResult AtomShakeModule::process(ModuleContext &moduleContext)
@@ -40,14 +42,90 @@ Module::ExecutionResult AtomShakeModule::process(ModuleContext &moduleContext)
     auto kernel = KernelProducer::energyKernel(targetConfiguration_, moduleContext.processPool(),
                                                moduleContext.dissolve().potentialMap(), rCut);
 
-    // Initialise the random number buffer so it is suitable for our parallel strategy within the main loop
-    RandomBuffer randomBuffer(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
+    // Initialise the random number stream so it is suitable for our parallel strategy within the main loop
+    RandomStream randomStream(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
 
+    // Statistics for a set of moves
+    struct ShakeStatistics
+    {
+        int nAttempts{0}, nAccepted{0};
+        double totalDelta{0.0};
+    };
     auto nAttempts = 0, nAccepted = 0;
-    bool accept;
-    double currentEnergy, currentIntraEnergy, newEnergy, newIntraEnergy, delta, totalDelta = 0.0;
-    Vec3<double> rDelta;
-    EnergyResult er;
+    auto totalDelta = 0.0;
+    const auto *box = targetConfiguration_->box();
+    const auto &cells = targetConfiguration_->cells();
+
+    // Shake all atoms in the specified Molecule, drawing random numbers from the supplied stream
+    // If a domain is specified, any move which would take an atom outside of it, or into a cell with no free storage slots, is
+    // rejected without evaluating its energy
+    auto shakeMolecule = [&](int molId, ChangeStore &store, RandomStream &stream, const DomainDecomposition &domains,
+                             int domain, ShakeStatistics &stats)
+    {
+
+        // Get Molecule pointer
+        std::shared_ptr<Molecule> mol = targetConfiguration_->molecule(molId);
+
+        // Set current Atom targets in ChangeStore (whole Molecule)
+        store.add(mol);
+        auto storeIndex = 0;
+
+        // Loop over atoms in the Molecule
+        for (const auto &i : mol->atoms())
+        {
+            // Calculate reference energies for the Atom
+            auto er = kernel->totalEnergy(*i);
+            auto currentEnergy = er.totalUnbound();
+            auto currentIntraEnergy = er.geometry() * termScale;
+
+            // Loop over number of shakes per Atom
+            for (auto n = 0; n < nShakesPerAtom_; ++n)
+            {
+                // Create a random translation vector
+                Vec3<double> rDelta(stream.randomPlusMinusOne() * stepSize_, stream.randomPlusMinusOne() * stepSize_,
+                                    stream.randomPlusMinusOne() * stepSize_);
+
+                // Translate Atom, rejecting the move outright if it leaves the domain or cell storage would need to be laid out
+                // afresh (which must not happen while other domains are being modified)
+                i->translateCoordinates(rDelta);
+                ++stats.nAttempts;
+                if (domain != -1 && (domains.domain(cells.cell(box->fold(i->r()))) != domain || !cells.canMoveInPlace(i)))
+                {
+                    store.revert(storeIndex);
+                    continue;
+                }
+
+                // Update the Atom's Cell position
+                targetConfiguration_->updateAtomLocation(i);
+
+                // Calculate new energy
+                er = kernel->totalEnergy(*i);
+                auto newEnergy = er.totalUnbound();
+                auto newIntraEnergy = er.geometry() * termScale;
+
+                // Trial the transformed Atom position
+                auto delta = (newEnergy + newIntraEnergy) - (currentEnergy + currentIntraEnergy);
+                auto accept = delta < 0 ? true : (stream.random() < exp(-delta * rRT));
+
+                if (accept)
+                {
+                    // Accept new (current) position of target Atom
+                    store.updateAtom(storeIndex);
+                    currentEnergy = newEnergy;
+                    stats.totalDelta += delta;
+                    ++stats.nAccepted;
+                }
+                else
+                    store.revert(storeIndex);
+            }
+
+            // Increment index of target atom in ChangeStore
+            ++storeIndex;
+        }
+
+        // Store modifications to Atom positions ready for broadcast later
+        store.storeAndReset();
+    };
 
     Timer timer;
     while (distributor.cycle())
@@ -61,85 +139,63 @@ Module::ExecutionResult AtomShakeModule::process(ModuleContext &moduleContext)
             // Set the new strategy
             strategy = distributor.currentStrategy();
 
-            // Re-initialise the random buffer
-            randomBuffer.reset(ProcessPool::subDivisionStrategy(strategy));
+            // Re-initialise the random stream
+            randomStream.reset(ProcessPool::subDivisionStrategy(strategy));
         }
 
-        // Loop over target Molecules
-        for (auto molId : targetMolecules)
-        {
-            /*
-             * Calculation Begins
-             */
-
-            // Get Molecule pointer
-            std::shared_ptr<Molecule> mol = targetConfiguration_->molecule(molId);
+        // Partition target Molecules into slabs of cells which can be shaken concurrently, rotating the slab boundaries at
+        // random on each cycle - any which span slabs are shaken serially afterwards
+        ShakeStatistics cycleStatistics;
+        DomainDecomposition domains(cells, static_cast<int>(randomStream.random() * cells.divisions().x));
+        auto serialMolecules = domains.partition(targetConfiguration_, targetMolecules);
 
-            // Set current Atom targets in ChangeStore (whole Molecule)
-            changeStore.add(mol);
-            auto storeIndex = 0;
+        // Make sure every cell has a free slot, so that few moves between cells are rejected for lack of one
+        if (domains.nDomains() > 0)
+            targetConfiguration_->cells().reserveFreeSlots(1);
 
-            // Loop over atoms in the Molecule
-            for (const auto &i : mol->atoms())
+        // Storage must stay in place while domains are shaken concurrently
+        targetConfiguration_->cells().setStorageFixed(true);
+        for (auto colour : {0, 1})
+        {
+            auto colourDomains = domains.concurrentDomains(colour);
+
+            // Create an independent random stream for each domain
+            std::vector<RandomStream> domainStreams;
+            for (auto n = 0; n < colourDomains.size(); ++n)
+                domainStreams.emplace_back(randomStream.createTaskStream());
+            std::vector<ChangeStore> domainChangeStores(colourDomains.size(), ChangeStore(moduleContext.processPool()));
+            std::vector<ShakeStatistics> domainStatistics(colourDomains.size());
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                               dissolve::counting_iterator<int>(colourDomains.size()),
+                               [&](const auto n)
+                               {
+                                   for (auto molId : domains.molecules(colourDomains[n]))
+                                       shakeMolecule(molId, domainChangeStores[n], domainStreams[n], domains, colourDomains[n],
+                                                     domainStatistics[n]);
+                               });
+
+            // Gather changes and statistics from each domain
+            for (auto n = 0; n < colourDomains.size(); ++n)
             {
-                // Calculate reference energies for the Atom
-                er = kernel->totalEnergy(*i);
-                currentEnergy = er.totalUnbound();
-                currentIntraEnergy = er.geometry() * termScale;
-
-                // Loop over number of shakes per Atom
-                for (auto n = 0; n < nShakesPerAtom_; ++n)
-                {
-                    // Create a random translation vector
-                    rDelta.set(randomBuffer.randomPlusMinusOne() * stepSize_, randomBuffer.randomPlusMinusOne() * stepSize_,
-                               randomBuffer.randomPlusMinusOne() * stepSize_);
-
-                    // Translate Atom and update its Cell position
-                    i->translateCoordinates(rDelta);
-                    targetConfiguration_->updateAtomLocation(i);
-
-                    // Calculate new energy
-                    er = kernel->totalEnergy(*i);
-                    newEnergy = er.totalUnbound();
-                    newIntraEnergy = er.geometry() * termScale;
-
-                    // Trial the transformed Atom position
-                    delta = (newEnergy + newIntraEnergy) - (currentEnergy + currentIntraEnergy);
-                    accept = delta < 0 ? true : (randomBuffer.random() < exp(-delta * rRT));
-
-                    if (accept)
-                    {
-                        // Accept new (current) position of target Atom
-                        changeStore.updateAtom(storeIndex);
-                        currentEnergy = newEnergy;
-                    }
-                    else
-                        changeStore.revert(storeIndex);
-
-                    // Increase attempt counters
-                    // The strategy in force at any one time may vary, so use the distributor's
-                    // helper functions.
-                    if (distributor.collectStatistics())
-                    {
-                        if (accept)
-                        {
-                            totalDelta += delta;
-                            ++nAccepted;
-                        }
-                        ++nAttempts;
-                    }
-                }
-
-                // Increment index of target atom in ChangeStore
-                ++storeIndex;
+                changeStore.takeChanges(domainChangeStores[n]);
+                cycleStatistics.nAttempts += domainStatistics[n].nAttempts;
+                cycleStatistics.nAccepted += domainStatistics[n].nAccepted;
+                cycleStatistics.totalDelta += domainStatistics[n].totalDelta;
             }
+        }
+        targetConfiguration_->cells().setStorageFixed(false);
 
-            // Store modifications to Atom positions ready for broadcast later
-            changeStore.storeAndReset();
+        // Loop over remaining target Molecules
+        for (auto molId : serialMolecules)
+            shakeMolecule(molId, changeStore, randomStream, domains, -1, cycleStatistics);
 
-            /*
-             * Calculation End
-             */
+        // Increase attempt counters
+        // The strategy in force at any one time may vary, so use the distributor's helper functions.
+        if (distributor.collectStatistics())
+        {
+            nAttempts += cycleStatistics.nAttempts;
+            nAccepted += cycleStatistics.nAccepted;
+            totalDelta += cycleStatistics.totalDelta;
         }
 
         // Now all target Molecules have been processes, broadcast the changes made
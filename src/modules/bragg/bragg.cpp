@@ -40,4 +40,9 @@ BraggModule::BraggModule() : Module(ModuleTypes::Bragg)
 
     keywords_.setOrganisation("Export");
     keywords_.add<BoolKeyword>("SaveReflections", "Whether to save Bragg reflection data to disk", saveReflections_);
+
+    keywords_.setOrganisation("Advanced");
+    keywords_.add<DoubleKeyword>("AtomVectorMemory",
+                                 "Maximum memory (in MB) to use for atomic cos/sin terms before they are calculated in blocks",
+                                 atomVectorMemory_, 1.0);
 }
@@ -34,6 +34,8 @@ class BraggModule : public Module
     double qMin_{0.01};
     // Whether to save Bragg reflection data to disk
     bool saveReflections_{false};
+    // Maximum memory (in MB) to use for atomic cos/sin terms before calculating them in blocks
+    double atomVectorMemory_{256.0};
 
     /*
      * Functions
@@ -41,7 +43,8 @@ class BraggModule : public Module
     public:
     // Calculate Bragg terms for specified Configuration
     bool calculateBraggTerms(GenericList &moduleData, const ProcessPool &procPool, Configuration *cfg, const double qMin,
-                             const double qDelta, const double qMax, Vec3<int> multiplicity, bool &alreadyUpToDate);
+                             const double qDelta, const double qMax, Vec3<int> multiplicity, double atomVectorMemory,
+                             bool &alreadyUpToDate);
     // Form partial and total reflection functions from calculated reflection data
     bool formReflectionFunctions(GenericList &moduleData, const ProcessPool &procPool, Configuration *cfg, const double qMin,
                                  const double qDelta, const double qMax);
@@ -19,7 +19,7 @@
 // Calculate unweighted Bragg scattering for specified Configuration
 bool BraggModule::calculateBraggTerms(GenericList &moduleData, const ProcessPool &procPool, Configuration *cfg,
                                       const double qMin, const double qDelta, const double qMax, Vec3<int> multiplicity,
-                                      bool &alreadyUpToDate)
+                                      double atomVectorMemory, bool &alreadyUpToDate)
 {
     // Check to see if the arrays are up-to-date
     auto braggDataVersion = moduleData.valueOr<int>("Version", name_, -1);
@@ -31,12 +31,6 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, const ProcessPool
     auto &braggKVectors = moduleData.realise<std::vector<KVector>>("KVectors", cfg->niceName());
     auto &braggReflections =
         moduleData.realise<std::vector<BraggReflection>>("Reflections", name(), GenericItem::InRestartFileFlag);
-    auto &braggAtomVectorXCos = moduleData.realise<Array2D<double>>("AtomVectorXCos", name());
-    auto &braggAtomVectorYCos = moduleData.realise<Array2D<double>>("AtomVectorYCos", name());
-    auto &braggAtomVectorZCos = moduleData.realise<Array2D<double>>("AtomVectorZCos", name());
-    auto &braggAtomVectorXSin = moduleData.realise<Array2D<double>>("AtomVectorXSin", name());
-    auto &braggAtomVectorYSin = moduleData.realise<Array2D<double>>("AtomVectorYSin", name());
-    auto &braggAtomVectorZSin = moduleData.realise<Array2D<double>>("AtomVectorZSin", name());
     auto &braggMaximumHKL = moduleData.realise<Vec3<int>>("MaximumHKL", name());
 
     // Grab some useful values
@@ -62,9 +56,7 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, const ProcessPool
     Messenger::print("	r(z) = {:e} {:e} {:e} ({:e})\n", rAxes.columnAsVec3(2).x, rAxes.columnAsVec3(2).y,
                      rAxes.columnAsVec3(2).z, rLengths.z);
 
-    int n, m, h, k, l, kAbs, lAbs;
-    double *cosTermsH, *sinTermsH, *cosTermsK, *sinTermsK, *cosTermsL, *sinTermsL;
-    double hkCos, hkSin, hklCos, hklSin;
+    int h, k, l;
 
     // Create a timer
     Timer timer;
@@ -162,127 +154,168 @@ bool BraggModule::calculateBraggTerms(GenericList &moduleData, const ProcessPool
                          timer.elapsedTimeString());
         Messenger::print("{} unique Bragg reflections found using a Q resolution of {} Angstroms**-1.\n",
                          braggReflections.size(), qDelta);
-
-        // Create atom working arrays
-        braggAtomVectorXCos.initialise(nAtoms, braggMaximumHKL.x + 1);
-        braggAtomVectorYCos.initialise(nAtoms, braggMaximumHKL.y + 1);
-        braggAtomVectorZCos.initialise(nAtoms, braggMaximumHKL.z + 1);
-        braggAtomVectorXSin.initialise(nAtoms, 2 * braggMaximumHKL.x + 1);
-        braggAtomVectorYSin.initialise(nAtoms, 2 * braggMaximumHKL.y + 1);
-        braggAtomVectorZSin.initialise(nAtoms, 2 * braggMaximumHKL.z + 1);
     }
 
-    // Precalculate cos/sin terms for atoms
+    /*
+     * Calculate k-vector contributions
+     *
+     * Atomic cos/sin terms are generated and consumed in blocks of atoms, so that only the working arrays for a single block
+     * are held in memory at once. If the arrays for all atoms fit within the specified memory limit they are generated in a
+     * single block.
+     *
+     * Within a block, k-vectors are split into groups which are processed in parallel, each group accumulating the
+     * contributions of every atom into its own per-type sums. Since the hkl indices and sums are held in plain arrays, the
+     * complex product over the k-vectors of a group can be vectorised.
+     */
     timer.stop();
     timer.zero();
     timer.start();
-    Vec3<double> v, rI;
-    for (n = 0; n < nAtoms; ++n)
-    {
-        // Skip unphysical atoms
-        if (!atoms[n].isPresence(SpeciesAtom::Presence::Physical))
-            continue;
 
-        // Calculate reciprocal lattice atom coordinates
-        // TODO CHECK Test this in a non-cubic system!
-        v = atoms[n].r();
-        rI.x = v.x * rAxes[0] + v.y * rAxes[1] + v.z * rAxes[2];
-        rI.y = v.x * rAxes[3] + v.y * rAxes[4] + v.z * rAxes[5];
-        rI.z = v.x * rAxes[6] + v.y * rAxes[7] + v.z * rAxes[8];
-
-        // Grab pointers to cos/sin arrays for atom
-        cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
-        cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
-        cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
-        sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
-        sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
-        sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
-
-        // Initialise zeroth and first terms
-        cosTermsH[0] = 1.0;
-        cosTermsK[0] = 1.0;
-        cosTermsL[0] = 1.0;
-        sinTermsH[0] = 0.0;
-        sinTermsK[0] = 0.0;
-        sinTermsL[0] = 0.0;
-        cosTermsH[1] = cos(rI.x);
-        cosTermsK[1] = cos(rI.y);
-        cosTermsL[1] = cos(rI.z);
-        sinTermsH[1] = sin(rI.x);
-        sinTermsK[1] = sin(rI.y);
-        sinTermsL[1] = sin(rI.z);
-        sinTermsH[-1] = -sinTermsH[1];
-        sinTermsK[-1] = -sinTermsK[1];
-        sinTermsL[-1] = -sinTermsL[1];
-
-        // Generate H terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.x; ++m)
-        {
-            cosTermsH[m] = cosTermsH[1] * cosTermsH[m - 1] - sinTermsH[1] * sinTermsH[m - 1];
-            sinTermsH[m] = cosTermsH[1] * sinTermsH[m - 1] + sinTermsH[1] * cosTermsH[m - 1];
-            sinTermsH[-m] = -sinTermsH[m];
-        }
-        // Generate K terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.y; ++m)
-        {
-            cosTermsK[m] = cosTermsK[1] * cosTermsK[m - 1] - sinTermsK[1] * sinTermsK[m - 1];
-            sinTermsK[m] = cosTermsK[1] * sinTermsK[m - 1] + sinTermsK[1] * cosTermsK[m - 1];
-            sinTermsK[-m] = -sinTermsK[m];
-        }
-        // Generate L terms via power expansion
-        for (m = 2; m <= braggMaximumHKL.z; ++m)
-        {
-            cosTermsL[m] = cosTermsL[1] * cosTermsL[m - 1] - sinTermsL[1] * sinTermsL[m - 1];
-            sinTermsL[m] = cosTermsL[1] * sinTermsL[m - 1] + sinTermsL[1] * cosTermsL[m - 1];
-            sinTermsL[-m] = -sinTermsL[m];
-        }
+    // Determine atom block size from the memory required for the cos/sin terms of a single atom
+    const auto bytesPerAtom = sizeof(double) * (3 * (braggMaximumHKL.x + braggMaximumHKL.y + braggMaximumHKL.z) + 6);
+    const auto atomBlockSize = std::clamp(int(atomVectorMemory * 1024 * 1024 / bytesPerAtom), 1, std::max(nAtoms, 1));
+    if (atomBlockSize < nAtoms)
+        Messenger::print("Atomic cos/sin terms will be calculated in {} blocks of up to {} atoms.\n",
+                         (nAtoms + atomBlockSize - 1) / atomBlockSize, atomBlockSize);
+
+    // Create atom working arrays for a single block
+    Array2D<double> atomVectorXCos(atomBlockSize, braggMaximumHKL.x + 1), atomVectorYCos(atomBlockSize, braggMaximumHKL.y + 1),
+        atomVectorZCos(atomBlockSize, braggMaximumHKL.z + 1), atomVectorXSin(atomBlockSize, 2 * braggMaximumHKL.x + 1),
+        atomVectorYSin(atomBlockSize, 2 * braggMaximumHKL.y + 1), atomVectorZSin(atomBlockSize, 2 * braggMaximumHKL.z + 1);
+
+    // Extract k-vector indices and create per-type cos/sin sums, ordered by k-vector group and then by type
+    const auto nKVectors = int(braggKVectors.size());
+    constexpr auto kVectorGroupSize = 256;
+    std::vector<int> hIndices(nKVectors), kIndices(nKVectors), lIndices(nKVectors);
+    for (auto i = 0; i < nKVectors; ++i)
+    {
+        hIndices[i] = braggKVectors[i].h();
+        kIndices[i] = braggKVectors[i].k();
+        lIndices[i] = braggKVectors[i].l();
     }
-    timer.stop();
-    Messenger::print("Calculated atomic cos/sin terms ({} elapsed)\n", timer.totalTimeString());
+    std::vector<double> cosSums(nTypes * nKVectors, 0.0), sinSums(nTypes * nKVectors, 0.0);
 
-    // Calculate k-vector contributions
-    int localTypeIndex;
+    for (auto blockBegin = 0; blockBegin < nAtoms; blockBegin += atomBlockSize)
+    {
+        const auto blockEnd = std::min(blockBegin + atomBlockSize, nAtoms);
 
-    // Zero k-vector cos/sin contributions
-    std::for_each(braggKVectors.begin(), braggKVectors.end(), [](auto &kvec) { kvec.zeroCosSinTerms(); });
+        // Precalculate cos/sin terms for atoms in the block
+        dissolve::for_each(
+            ParallelPolicies::par, dissolve::counting_iterator<int>(blockBegin), dissolve::counting_iterator<int>(blockEnd),
+            [&](const auto n)
+            {
+                // Skip unphysical atoms
+                if (!atoms[n].isPresence(SpeciesAtom::Presence::Physical))
+                    return;
+
+                // Calculate reciprocal lattice atom coordinates
+                // TODO CHECK Test this in a non-cubic system!
+                Vec3<double> v = atoms[n].r(), rI;
+                rI.x = v.x * rAxes[0] + v.y * rAxes[1] + v.z * rAxes[2];
+                rI.y = v.x * rAxes[3] + v.y * rAxes[4] + v.z * rAxes[5];
+                rI.z = v.x * rAxes[6] + v.y * rAxes[7] + v.z * rAxes[8];
+
+                // Grab pointers to cos/sin arrays for atom
+                auto *cosTermsH = atomVectorXCos.pointerAt(n - blockBegin, 0);
+                auto *cosTermsK = atomVectorYCos.pointerAt(n - blockBegin, 0);
+                auto *cosTermsL = atomVectorZCos.pointerAt(n - blockBegin, 0);
+                auto *sinTermsH = atomVectorXSin.pointerAt(n - blockBegin, braggMaximumHKL.x);
+                auto *sinTermsK = atomVectorYSin.pointerAt(n - blockBegin, braggMaximumHKL.y);
+                auto *sinTermsL = atomVectorZSin.pointerAt(n - blockBegin, braggMaximumHKL.z);
+
+                // Initialise zeroth and first terms
+                cosTermsH[0] = 1.0;
+                cosTermsK[0] = 1.0;
+                cosTermsL[0] = 1.0;
+                sinTermsH[0] = 0.0;
+                sinTermsK[0] = 0.0;
+                sinTermsL[0] = 0.0;
+                cosTermsH[1] = cos(rI.x);
+                cosTermsK[1] = cos(rI.y);
+                cosTermsL[1] = cos(rI.z);
+                sinTermsH[1] = sin(rI.x);
+                sinTermsK[1] = sin(rI.y);
+                sinTermsL[1] = sin(rI.z);
+                sinTermsH[-1] = -sinTermsH[1];
+                sinTermsK[-1] = -sinTermsK[1];
+                sinTermsL[-1] = -sinTermsL[1];
+
+                // Generate H terms via power expansion
+                for (auto m = 2; m <= braggMaximumHKL.x; ++m)
+                {
+                    cosTermsH[m] = cosTermsH[1] * cosTermsH[m - 1] - sinTermsH[1] * sinTermsH[m - 1];
+                    sinTermsH[m] = cosTermsH[1] * sinTermsH[m - 1] + sinTermsH[1] * cosTermsH[m - 1];
+                    sinTermsH[-m] = -sinTermsH[m];
+                }
+                // Generate K terms via power expansion
+                for (auto m = 2; m <= braggMaximumHKL.y; ++m)
+                {
+                    cosTermsK[m] = cosTermsK[1] * cosTermsK[m - 1] - sinTermsK[1] * sinTermsK[m - 1];
+                    sinTermsK[m] = cosTermsK[1] * sinTermsK[m - 1] + sinTermsK[1] * cosTermsK[m - 1];
+                    sinTermsK[-m] = -sinTermsK[m];
+                }
+                // Generate L terms via power expansion
+                for (auto m = 2; m <= braggMaximumHKL.z; ++m)
+                {
+                    cosTermsL[m] = cosTermsL[1] * cosTermsL[m - 1] - sinTermsL[1] * sinTermsL[m - 1];
+                    sinTermsL[m] = cosTermsL[1] * sinTermsL[m - 1] + sinTermsL[1] * cosTermsL[m - 1];
+                    sinTermsL[-m] = -sinTermsL[m];
+                }
+            });
 
-    // Loop over atoms
-    timer.start();
-    for (n = 0; n < nAtoms; ++n)
-    {
-        // Skip unphysical atoms
-        if (!atoms[n].isPresence(SpeciesAtom::Presence::Physical))
-            continue;
+        // Accumulate contributions from atoms in the block
+        dissolve::for_each(
+            ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+            dissolve::counting_iterator<int>((nKVectors + kVectorGroupSize - 1) / kVectorGroupSize),
+            [&](const auto group)
+            {
+                const auto offset = group * kVectorGroupSize, groupSize = std::min(kVectorGroupSize, nKVectors - offset);
+                const auto *hs = hIndices.data() + offset, *ks = kIndices.data() + offset, *ls = lIndices.data() + offset;
 
-        // Grab localTypeIndex and array pointers for this atom
-        localTypeIndex = atoms[n].localTypeIndex();
+                // Loop over atoms
+                for (auto n = blockBegin; n < blockEnd; ++n)
+                {
+                    // Skip unphysical atoms
+                    if (!atoms[n].isPresence(SpeciesAtom::Presence::Physical))
+                        continue;
 
-        cosTermsH = braggAtomVectorXCos.pointerAt(n, 0);
-        cosTermsK = braggAtomVectorYCos.pointerAt(n, 0);
-        cosTermsL = braggAtomVectorZCos.pointerAt(n, 0);
-        sinTermsH = braggAtomVectorXSin.pointerAt(n, braggMaximumHKL.x);
-        sinTermsK = braggAtomVectorYSin.pointerAt(n, braggMaximumHKL.y);
-        sinTermsL = braggAtomVectorZSin.pointerAt(n, braggMaximumHKL.z);
+                    // Grab sums for this atom's type, and its cos/sin arrays
+                    auto *cosSum = cosSums.data() + offset * nTypes + atoms[n].localTypeIndex() * groupSize;
+                    auto *sinSum = sinSums.data() + offset * nTypes + atoms[n].localTypeIndex() * groupSize;
+                    const auto *cosTermsH = atomVectorXCos.pointerAt(n - blockBegin, 0);
+                    const auto *cosTermsK = atomVectorYCos.pointerAt(n - blockBegin, 0);
+                    const auto *cosTermsL = atomVectorZCos.pointerAt(n - blockBegin, 0);
+                    const auto *sinTermsH = atomVectorXSin.pointerAt(n - blockBegin, braggMaximumHKL.x);
+                    const auto *sinTermsK = atomVectorYSin.pointerAt(n - blockBegin, braggMaximumHKL.y);
+                    const auto *sinTermsL = atomVectorZSin.pointerAt(n - blockBegin, braggMaximumHKL.z);
+
+                    // Loop over k-vectors in the group
+                    for (auto i = 0; i < groupSize; ++i)
+                    {
+                        const auto h = hs[i], k = ks[i], l = ls[i];
+                        const auto kAbs = abs(k), lAbs = abs(l);
+
+                        // Calculate complex product from atomic cos/sin terms
+                        const auto hkCos = cosTermsH[h] * cosTermsK[kAbs] - sinTermsH[h] * sinTermsK[k];
+                        const auto hkSin = cosTermsH[h] * sinTermsK[k] + sinTermsH[h] * cosTermsK[kAbs];
+                        cosSum[i] += hkCos * cosTermsL[lAbs] - hkSin * sinTermsL[l];
+                        sinSum[i] += hkCos * sinTermsL[l] + hkSin * cosTermsL[lAbs];
+                    }
+                }
+            });
+    }
 
-        // Loop over k-vectors
-        for (auto &kvec : braggKVectors)
+    // Store contributions in the k-vectors' cos/sin arrays
+    for (auto i = 0; i < nKVectors; ++i)
+    {
+        const auto offset = (i / kVectorGroupSize) * kVectorGroupSize;
+        const auto groupSize = std::min(kVectorGroupSize, nKVectors - offset);
+        auto &kvec = braggKVectors[i];
+        kvec.zeroCosSinTerms();
+        for (auto t = 0; t < nTypes; ++t)
         {
-            // Grab h, k, and l indices from KVector
-            h = kvec.h();
-            k = kvec.k();
-            l = kvec.l();
-            kAbs = abs(k);
-            lAbs = abs(l);
-
-            // Calculate complex product from atomic cos/sin terms
-            hkCos = cosTermsH[h] * cosTermsK[kAbs] - sinTermsH[h] * sinTermsK[k];
-            hkSin = cosTermsH[h] * sinTermsK[k] + sinTermsH[h] * cosTermsK[kAbs];
-            hklCos = hkCos * cosTermsL[lAbs] - hkSin * sinTermsL[l];
-            hklSin = hkCos * sinTermsL[l] + hkSin * cosTermsL[lAbs];
-
-            // Sum contribution into the k-vector's cos/sin arrays
-            kvec.addCosTerm(localTypeIndex, hklCos);
-            kvec.addSinTerm(localTypeIndex, hklSin);
+            kvec.addCosTerm(t, cosSums[offset * nTypes + t * groupSize + i - offset]);
+            kvec.addSinTerm(t, sinSums[offset * nTypes + t * groupSize + i - offset]);
         }
     }
     timer.stop();
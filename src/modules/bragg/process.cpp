@@ -49,7 +49,7 @@ Module::ExecutionResult BraggModule::process(ModuleContext &moduleContext)
     // Calculate Bragg vectors and intensities for the current Configuration
     bool alreadyUpToDate;
     if (!calculateBraggTerms(moduleContext.dissolve().processingModuleData(), moduleContext.processPool(), targetConfiguration_,
-                             qMin_, qDelta_, qMax_, multiplicity_, alreadyUpToDate))
+                             qMin_, qDelta_, qMax_, multiplicity_, atomVectorMemory_, alreadyUpToDate))
         return ExecutionResult::Failed;
 
     // If we are already up-to-date, then there's nothing more to do for this Configuration
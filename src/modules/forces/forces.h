@@ -5,11 +5,13 @@
 
 #include "io/export/forces.h"
 #include "io/import/forces.h"
+#include "kernels/force.h"
 #include "module/module.h"
 #include <memory>
 
 // Forward Declarations
 class Molecule;
+class NeighbourList;
 class PotentialMap;
 
 // Forces Module
@@ -58,15 +60,25 @@ class ForcesModule : public Module
         IntraMolecularFull,
         IntraMolecularGeometry
     };
-    // Calculate total forces within the specified Configuration
-    static void totalForces(const ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+    // Calculate total forces within the specified Configuration, optionally returning pair potential energy and virial
+    // If an ownership is supplied, the resulting forces are complete only for the atoms owned by this process, and false is
+    // returned if they could not be exchanged
+    static bool totalForces(const ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
                             ForceCalculationType calculationType, std::vector<Vec3<double>> &fUnbound,
-                            std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer = {});
+                            std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer = {},
+                            OptionalReferenceWrapper<const NeighbourList> neighbourList = {},
+                            OptionalReferenceWrapper<ForceKernel::EnergyAndVirial> energyAndVirial = {},
+                            OptionalReferenceWrapper<const AtomOwnership> ownership = {});
+    // Send force contributions on atoms owned by other processes to their owners, leaving forces complete for owned atoms only
+    static bool exchangeOwnedForces(const ProcessPool &procPool, const Configuration *cfg, const AtomOwnership &ownership,
+                                    std::vector<Vec3<double>> &fUnbound, std::vector<Vec3<double>> &fBound,
+                                    OptionalReferenceWrapper<Timer> commsTimer = {});
     // Calculate forces acting on specific Molecules within the specified Configuration (arising from all atoms)
-    static void totalForces(const ProcessPool &procPool, Configuration *cfg,
+    static bool totalForces(const ProcessPool &procPool, Configuration *cfg,
                             const std::vector<const Molecule *> &targetMolecules, const PotentialMap &potentialMap,
                             ForceCalculationType calculationType, std::vector<Vec3<double>> &fUnbound,
-                            std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer = {});
+                            std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer = {},
+                            OptionalReferenceWrapper<const NeighbourList> neighbourList = {});
     // Calculate total forces within the specified Species
     static void totalForces(const ProcessPool &procPool, const Species *sp, const PotentialMap &potentialMap,
                             ForceCalculationType calculationType, std::vector<Vec3<double>> &fUnbound,
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
+#include "classes/atomOwnership.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
 #include "classes/potentialMap.h"
@@ -8,10 +9,13 @@
 #include "kernels/producer.h"
 #include "modules/forces/forces.h"
 
-// Calculate total forces within the supplied Configuration
-void ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
+// Calculate total forces within the supplied Configuration, optionally returning pair potential energy and virial
+bool ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg, const PotentialMap &potentialMap,
                                ForceCalculationType calculationType, std::vector<Vec3<double>> &fUnbound,
-                               std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer)
+                               std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer,
+                               OptionalReferenceWrapper<const NeighbourList> neighbourList,
+                               OptionalReferenceWrapper<ForceKernel::EnergyAndVirial> energyAndVirial,
+                               OptionalReferenceWrapper<const AtomOwnership> ownership)
 {
     // Create a Timer
     Timer timer;
@@ -22,39 +26,128 @@ void ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg,
         std::fill(fBound.begin(), fBound.end(), Vec3<double>());
 
     // Create a ForceKernel
-    auto kernel = KernelProducer::forceKernel(cfg, procPool, potentialMap);
+    auto kernel = KernelProducer::forceKernel(cfg, procPool, potentialMap, {}, neighbourList);
 
-    timer.start();
-    if (calculationType == ForceCalculationType::Full)
-        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy);
-    else if (calculationType == ForceCalculationType::PairPotentialOnly)
-        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy,
-                            {ForceKernel::ExcludeGeometry, ForceKernel::ExcludeExtended});
+    // Determine terms to exclude for the calculation type
+    Flags<ForceKernel::ForceCalculationFlags> flags;
+    if (calculationType == ForceCalculationType::PairPotentialOnly)
+        flags.setFlags(ForceKernel::ExcludeGeometry, ForceKernel::ExcludeExtended);
     else if (calculationType == ForceCalculationType::IntraMolecularFull)
-        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy,
-                            {ForceKernel::ExcludeInterMolecularPairPotential, ForceKernel::ExcludeExtended});
+        flags.setFlags(ForceKernel::ExcludeInterMolecularPairPotential, ForceKernel::ExcludeExtended);
     else if (calculationType == ForceCalculationType::IntraMolecularGeometry)
-        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy,
-                            {ForceKernel::ExcludeInterMolecularPairPotential, ForceKernel::ExcludeIntraMolecularPairPotential,
-                             ForceKernel::ExcludeExtended});
+        flags.setFlags(ForceKernel::ExcludeInterMolecularPairPotential, ForceKernel::ExcludeIntraMolecularPairPotential,
+                       ForceKernel::ExcludeExtended);
+
+    timer.start();
+    std::optional<ProcessPool::VectorSumRequest> boundSum;
+    if (!ownership && calculationType == ForceCalculationType::Full && &fUnbound != &fBound && procPool.nProcesses() > 1)
+    {
+        // Calculate molecular terms first so that the reduction of the completed bound forces can proceed while the
+        // intermolecular pair potential forces are calculated
+        ForceKernel::EnergyAndVirial molecularEV, pairEV;
+        auto optionalEV = [&energyAndVirial](auto &ev) -> OptionalReferenceWrapper<ForceKernel::EnergyAndVirial>
+        {
+            if (energyAndVirial)
+                return ev;
+            return {};
+        };
+        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy, {ForceKernel::ExcludeInterMolecularPairPotential},
+                            optionalEV(molecularEV));
+        boundSum.emplace(procPool.allSumBegin({fBound}));
+        kernel->totalForces(fUnbound, fUnbound, ProcessPool::PoolStrategy,
+                            {ForceKernel::ExcludeGeometry, ForceKernel::ExcludeIntraMolecularPairPotential,
+                             ForceKernel::ExcludeExtended},
+                            optionalEV(pairEV));
+        if (energyAndVirial)
+            energyAndVirial->get() = molecularEV + pairEV;
+    }
+    else
+        kernel->totalForces(fUnbound, fBound, ProcessPool::PoolStrategy, flags, energyAndVirial, ownership);
 
     timer.stop();
     Messenger::printVerbose("Time to do forces was {}.\n", timer.totalTimeString());
 
-    // Gather forces together over all processes
-    procPool.allSum(fUnbound, ProcessPool::PoolProcessesCommunicator, commsTimer);
-    if (&fUnbound != &fBound)
-        procPool.allSum(fBound, ProcessPool::PoolProcessesCommunicator, commsTimer);
+    // Gather forces together over all processes, reducing both arrays in a single operation if they were not overlapped
+    if (ownership)
+    {
+        if (!exchangeOwnedForces(procPool, cfg, ownership->get(), fUnbound, fBound, commsTimer))
+            return false;
+    }
+    else if (boundSum)
+    {
+        procPool.allSum(fUnbound, ProcessPool::PoolProcessesCommunicator, commsTimer);
+        boundSum->wait(commsTimer);
+    }
+    else if (&fUnbound != &fBound)
+        procPool.allSumBegin({fUnbound, fBound}).wait(commsTimer);
+    else
+        procPool.allSum(fUnbound, ProcessPool::PoolProcessesCommunicator, commsTimer);
+
+    // Sum energy and virial over all processes
+    if (energyAndVirial)
+    {
+        auto &ev = energyAndVirial->get();
+        double values[3] = {ev.energy.interMolecular(), ev.energy.intraMolecular(), ev.virial};
+        procPool.allSum(values, 3, ProcessPool::PoolProcessesCommunicator, commsTimer);
+        ev = {{values[0], values[1]}, values[2]};
+    }
+
+    return true;
+}
+
+// Send force contributions on atoms owned by other processes to their owners, leaving forces complete for owned atoms only
+bool ForcesModule::exchangeOwnedForces(const ProcessPool &procPool, const Configuration *cfg, const AtomOwnership &ownership,
+                                       std::vector<Vec3<double>> &fUnbound, std::vector<Vec3<double>> &fBound,
+                                       OptionalReferenceWrapper<Timer> commsTimer)
+{
+    // Pack non-zero contributions (atom index, unbound force, and bound force if separate) by owning process - all such atoms
+    // lie within the halo cells of this process, whose owners are all partners
+    const auto separateBound = &fUnbound != &fBound;
+    const auto stride = separateBound ? 7 : 4;
+    auto isZero = [](const auto &f) { return f.x == 0.0 && f.y == 0.0 && f.z == 0.0; };
+    std::vector<std::vector<double>> contributions(ownership.partners().size()), received;
+    for (auto id : ownership.haloCells())
+    {
+        auto &buffer = contributions[ownership.partnerIndex(ownership.cellOwner(id))];
+        for (const auto *i : cfg->cells().cell(id)->atoms())
+        {
+            auto n = i->globalIndex();
+            if (isZero(fUnbound[n]) && isZero(fBound[n]))
+                continue;
+
+            buffer.insert(buffer.end(), {double(n), fUnbound[n].x, fUnbound[n].y, fUnbound[n].z});
+            if (separateBound)
+                buffer.insert(buffer.end(), {fBound[n].x, fBound[n].y, fBound[n].z});
+            fUnbound[n].zero();
+            fBound[n].zero();
+        }
+    }
+
+    // Exchange contributions with partners and sum those received into our owned atoms
+    if (!procPool.exchange(ownership.partners(), contributions, received, ProcessPool::PoolProcessesCommunicator, commsTimer))
+        return false;
+    for (const auto &buffer : received)
+        for (auto it = buffer.begin(); it != buffer.end(); it += stride)
+        {
+            auto n = int(it[0]);
+            fUnbound[n] += Vec3<double>(it[1], it[2], it[3]);
+            if (separateBound)
+                fBound[n] += Vec3<double>(it[4], it[5], it[6]);
+        }
+
+    return true;
 }
 
 // Calculate forces acting on specific Molecules within the specified Configuration (arising from all atoms)
-void ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg,
+bool ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg,
                                const std::vector<const Molecule *> &targetMolecules, const PotentialMap &potentialMap,
                                ForceCalculationType calculationType, std::vector<Vec3<double>> &fUnbound,
-                               std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer)
+                               std::vector<Vec3<double>> &fBound, OptionalReferenceWrapper<Timer> commsTimer,
+                               OptionalReferenceWrapper<const NeighbourList> neighbourList)
 {
     std::vector<Vec3<double>> tempFUnbound(fUnbound.size(), Vec3<double>()), tempFBound(fBound.size(), Vec3<double>());
-    totalForces(procPool, cfg, potentialMap, calculationType, tempFUnbound, tempFBound, commsTimer);
+    if (!totalForces(procPool, cfg, potentialMap, calculationType, tempFUnbound, tempFBound, commsTimer, neighbourList))
+        return false;
 
     // TODO Calculating forces for whole molecule at once may be more efficient
     // TODO Partitioning atoms of target molecules into cells and running a distributor may be more efficient
@@ -65,6 +158,8 @@ void ForcesModule::totalForces(const ProcessPool &procPool, Configuration *cfg,
             fUnbound[i->globalIndex()] = tempFUnbound[i->globalIndex()];
             fBound[i->globalIndex()] = tempFBound[i->globalIndex()];
         }
+
+    return true;
 }
 
 // Calculate total forces within the specified Species
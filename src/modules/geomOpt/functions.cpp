@@ -26,6 +26,7 @@ template <> void GeometryOptimisationModule::revertToReferenceCoordinates(Config
 {
     for (auto &&[ref, i] : zip(rRef_, cfg->atoms()))
         i.setCoordinates(ref);
+    cfg->updateAtomLocations();
 }
 
 // Revert Species to reference coordinates
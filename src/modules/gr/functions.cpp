@@ -6,6 +6,8 @@
 #include "classes/box.h"
 #include "classes/cell.h"
 #include "classes/configuration.h"
+#include "classes/coordinateBlock.h"
+#include "classes/minimumImage.h"
 #include "classes/species.h"
 #include "classes/speciesAngle.h"
 #include "classes/speciesBond.h"
@@ -19,6 +21,8 @@
 #include "templates/algorithms.h"
 #include "templates/combinable.h"
 #include <iterator>
+#include <map>
+#include <numeric>
 #include <tuple>
 
 namespace
@@ -32,6 +36,64 @@ void addHistogramsToPartialSet(Array2D<Histogram1D> &histograms, PartialSet &tar
             histo = std::move(histograms[{k, j}]);
         }
 }
+
+// Calculate histogram bin indices for distances between a reference position and a contiguous block of coordinates
+template <class MIM>
+void calculateBinIndices(const MIM &mim, double xi, double yi, double zi, const double *x, const double *y, const double *z,
+                         int nValues, double rMinimum, double binWidth, int *binIndices)
+{
+    // Loop body is free of branches and calls, allowing the compiler to vectorise it for the target instruction set
+    for (auto j = 0; j < nValues; ++j)
+    {
+        auto dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+        mim.apply(dx, dy, dz);
+        binIndices[j] = int((sqrt(dx * dx + dy * dy + dz * dz) - rMinimum) / binWidth);
+    }
+}
+
+// Coordinates bucketed by containing cell, stored contiguously in cell order
+struct CellSortedCoordinates
+{
+    CellSortedCoordinates(const CellArray &cellArray, const std::vector<double> &xs, const std::vector<double> &ys,
+                          const std::vector<double> &zs)
+        : cellBegin(cellArray.nCells() + 1, 0), indices(xs.size()), x(xs.size()), y(xs.size()), z(xs.size())
+    {
+        // Count atoms in each cell, and convert the counts into offsets
+        std::vector<int> cellIndices(xs.size());
+        for (auto n = 0; n < xs.size(); ++n)
+        {
+            cellIndices[n] = cellArray.cell(Vec3<double>(xs[n], ys[n], zs[n]))->index();
+            ++cellBegin[cellIndices[n] + 1];
+        }
+        std::partial_sum(cellBegin.begin(), cellBegin.end(), cellBegin.begin());
+
+        // Place atoms
+        auto insertAt = cellBegin;
+        for (auto n = 0; n < xs.size(); ++n)
+        {
+            auto pos = insertAt[cellIndices[n]]++;
+            indices[pos] = n;
+            x[pos] = xs[n];
+            y[pos] = ys[n];
+            z[pos] = zs[n];
+        }
+    }
+    // Offsets of the first atom in each cell (with a final end offset)
+    std::vector<int> cellBegin;
+    // Original atom indices, in cell order
+    std::vector<int> indices;
+    // Coordinates, in cell order
+    std::vector<double> x, y, z;
+};
+
+// Add pre-calculated bin indices into the histograms for each atom type, skipping ignored types
+template <class HistogramFunction>
+void binIndicesByType(HistogramFunction histogramForType, const int *types, const int *binIndices, int nValues)
+{
+    for (auto j = 0; j < nValues; ++j)
+        if (types[j] != AtomType::Ignore)
+            histogramForType(types[j]).binIndex(binIndices[j]);
+}
 } // namespace
 
 /*
@@ -189,10 +251,22 @@ bool GRModule::calculateGRCells(const ProcessPool &procPool, Configuration *cfg,
             return histograms;
         });
 
-    auto unaryOp = [&combinableHistograms, cfg, &comb, rdfRange](const auto idx)
+    // Scratch space for bin indices calculated in batches
+    auto combinableBinIndices = dissolve::CombinableFunctor<std::vector<int>>([]() { return std::vector<int>(); });
+
+    // Cell-ordered coordinates
+    const auto &coords = cfg->coordinateBlock();
+
+    // All partials share the same binning
+    if (partialSet.nAtomTypes() == 0)
+        return true;
+    const auto rMinimum = partialSet.fullHistogram(0, 0).minimum();
+    const auto binWidth = partialSet.fullHistogram(0, 0).binWidth();
+
+    auto unaryOp = [&](const auto idx)
     {
-        // auto &histograms = combinableHistograms.local().histograms_;
         auto &histograms = combinableHistograms.local();
+        auto &binIndices = combinableBinIndices.local();
         const auto *box = cfg->box();
         auto &cellArray = cfg->cells();
         auto [n, m] = comb.nthCombination(idx);
@@ -203,30 +277,29 @@ bool GRModule::calculateGRCells(const ProcessPool &procPool, Configuration *cfg,
             return;
 
         // Add contributions between atoms in cellI and cellJ
-        auto &atomsI = cellI->atoms();
-        auto &atomsJ = cellJ->atoms();
+        const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+        const auto *types = coords.localTypeIndices();
+        auto beginJ = coords.cellBegin(m), nJ = coords.cellEnd(m) - beginJ;
+        binIndices.resize(nJ);
 
         // Perform minimum image calculation on all atom pairs -
         // quicker than working out if we need to given the absence of a 2D look-up array
-        for (auto &i : atomsI)
-        {
-            auto typeI = i->localTypeIndex();
-            if (typeI == AtomType::Ignore)
-                continue;
-
-            auto &rI = i->r();
-
-            for (auto &j : atomsJ)
-            {
-                auto typeJ = j->localTypeIndex();
-                if (typeJ == AtomType::Ignore)
-                    continue;
-
-                auto &rJ = j->r();
-                auto distance = box->minimumDistance(rJ, rI);
-                histograms[{typeI, typeJ}].bin(distance);
-            }
-        }
+        MinimumImage::dispatch(*box,
+                               [&](const auto mim)
+                               {
+                                   for (auto i = coords.cellBegin(n); i < coords.cellEnd(n); ++i)
+                                   {
+                                       auto typeI = types[i];
+                                       if (typeI == AtomType::Ignore)
+                                           continue;
+
+                                       // Calculate bin indices for all atoms in cellJ, then add them to the histograms
+                                       calculateBinIndices(mim, x[i], y[i], z[i], x + beginJ, y + beginJ, z + beginJ, nJ,
+                                                           rMinimum, binWidth, binIndices.data());
+                                       binIndicesByType([&](int typeJ) -> Histogram1D & { return histograms[{typeI, typeJ}]; },
+                                                        types + beginJ, binIndices.data(), nJ);
+                                   }
+                               });
     };
 
     // Execute lambda operator for each cell
@@ -237,34 +310,219 @@ bool GRModule::calculateGRCells(const ProcessPool &procPool, Configuration *cfg,
 
     // Atoms within the same cell
     auto [start, end] = chop_range(0, cellArray.nCells(), nChunks, offset);
+    const auto *x = coords.x(), *y = coords.y(), *z = coords.z();
+    const auto *types = coords.localTypeIndices();
+    std::vector<int> binIndices;
     for (int n = start; n < end; ++n)
     {
-        auto *cellI = cellArray.cell(n);
-        auto &atomsI = cellI->atoms();
+        // Add contributions between atoms in cell n
+        auto cellBegin = coords.cellBegin(n), cellEnd = coords.cellEnd(n);
+        for (auto i = cellBegin; i < cellEnd; ++i)
+        {
+            auto typeI = types[i];
+            if (typeI == AtomType::Ignore)
+                continue;
 
-        // Add contributions between atoms in cellI
-        PairIterator pairs(atomsI.size());
-        std::for_each(
-            pairs.begin(), pairs.end(),
-            [&atomsI, &partialSet](auto it)
+            // No need to perform MIM since we're in the same cell
+            auto nJ = cellEnd - (i + 1);
+            binIndices.resize(nJ);
+            calculateBinIndices(MinimumImage::None(), x[i], y[i], z[i], x + i + 1, y + i + 1, z + i + 1, nJ, rMinimum, binWidth,
+                                binIndices.data());
+            binIndicesByType([&](int typeJ) -> Histogram1D & { return partialSet.fullHistogram(typeI, typeJ); },
+                             types + i + 1, binIndices.data(), nJ);
+        }
+    }
+    return true;
+}
+
+// Update full partial g(r) from reference data using only atoms which have moved, returning false if not possible
+bool GRModule::calculateGRIncremental(const ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet,
+                                      const double rdfRange, const double rdfBinWidth)
+{
+    // Maximum fraction of moved atoms for which an incremental update is attempted before any timings are available. Each
+    // moved atom is binned against its neighbours at both its old and new positions, while a full calculation bins each
+    // pair only once, so beyond a quarter of the atoms an incremental update cannot win. The measured crossover is about 19%.
+    constexpr auto initialMaxMovedFraction = 0.19;
+
+    // Check for compatible reference data
+    auto it = incrementalReferences_.find(cfg);
+    if (it == incrementalReferences_.end())
+        return false;
+    auto &reference = it->second;
+    const auto nAtoms = cfg->nAtoms();
+    if (partialSet.nAtomTypes() == 0 || reference.rdfRange != rdfRange || reference.binWidth != rdfBinWidth ||
+        reference.x.size() != nAtoms ||
+        reference.boxLengths != cfg->box()->axisLengths() || reference.boxAngles != cfg->box()->axisAngles() ||
+        reference.fullHistograms.nRows() != partialSet.nAtomTypes())
+        return false;
+
+    // Determine moved atoms, and assemble current coordinates
+    std::vector<double> x(nAtoms), y(nAtoms), z(nAtoms);
+    std::vector<int> moved;
+    std::vector<bool> isMoved(nAtoms, false);
+    const auto &atoms = cfg->atoms();
+    for (auto index = 0; index < nAtoms; ++index)
+    {
+        const auto &i = atoms[index];
+        if (i.localTypeIndex() != reference.types[index])
+            return false;
+
+        const auto &r = i.r();
+        x[index] = r.x;
+        y[index] = r.y;
+        z[index] = r.z;
+        if (r.x != reference.x[index] || r.y != reference.y[index] || r.z != reference.z[index])
+        {
+            moved.push_back(index);
+            isMoved[index] = true;
+        }
+    }
+
+    // Decide whether an incremental update is worthwhile - once both kinds of calculation have been timed, compare the
+    // predicted cost of updating the moved atoms with that of a full calculation. Timings from the master are used so that
+    // all processes reach the same decision.
+    auto fullTime = reference.fullTime, movedAtomTime = reference.movedAtomTime;
+    if (!procPool.broadcast(fullTime) || !procPool.broadcast(movedAtomTime))
+        return false;
+    if (fullTime > 0.0 && movedAtomTime > 0.0 ? moved.size() * movedAtomTime > fullTime
+                                              : moved.size() > initialMaxMovedFraction * nAtoms)
+        return false;
+
+    Messenger::print("Updating partials incrementally for {} moved atoms.\n", moved.size());
+    Timer timer;
+
+    // Bucket the previous and current coordinates by cell, and determine the unique cell grid deltas covering the rdf range
+    const auto &cellArray = cfg->cells();
+    CellSortedCoordinates oldCoordinates(cellArray, reference.x, reference.y, reference.z), newCoordinates(cellArray, x, y, z);
+    auto divisions = cellArray.divisions();
+    std::map<std::tuple<int, int, int>, Vec3<int>> uniqueDeltas;
+    uniqueDeltas.emplace(std::tuple<int, int, int>(0, 0, 0), Vec3<int>());
+    for (auto &delta : cellArray.neighbourGridDeltas(rdfRange))
+        uniqueDeltas.emplace(std::tuple<int, int, int>((delta.x % divisions.x + divisions.x) % divisions.x,
+                                                       (delta.y % divisions.y + divisions.y) % divisions.y,
+                                                       (delta.z % divisions.z + divisions.z) % divisions.z),
+                             delta);
+
+    // Accumulate changes to histograms, removing the previous contributions of moved atoms and adding their new ones
+    auto combinableHistograms = dissolve::CombinableValue<Array2D<Histogram1D>>(
+        [&partialSet]()
+        {
+            Array2D<Histogram1D> histograms;
+            histograms.initialise(partialSet.nAtomTypes(), partialSet.nAtomTypes(), true);
+            for (auto i = 0; i < partialSet.nAtomTypes(); ++i)
+                for (auto j = i; j < partialSet.nAtomTypes(); ++j)
+                    histograms[{i, j}] = partialSet.fullHistogram(i, j);
+            return histograms;
+        });
+    auto combinableBinIndices = dissolve::CombinableFunctor<std::vector<int>>([]() { return std::vector<int>(); });
+
+    // All partials share the same binning
+    const auto rMinimum = partialSet.fullHistogram(0, 0).minimum();
+    const auto binWidth = partialSet.fullHistogram(0, 0).binWidth();
+    const auto *types = reference.types.data();
+
+    auto offset = procPool.interleavedLoopStart(ProcessPool::PoolStrategy);
+    auto nChunks = procPool.interleavedLoopStride(ProcessPool::PoolStrategy);
+    auto [start, end] = chop_range(0, int(moved.size()), nChunks, offset);
+    MinimumImage::dispatch(
+        *cfg->box(),
+        [&](const auto mim)
+        {
+            // Bin (or unbin) distances between the moved atom and all other atoms in cells around its position
+            auto binAgainstNeighbours = [&](int i, int typeI, const CellSortedCoordinates &coordinates, double xi, double yi,
+                                            double zi, Array2D<Histogram1D> &histograms, std::vector<int> &bins, bool add)
             {
-                auto [idx, jdx] = it;
-                if (idx == jdx)
-                    return;
-                auto &i = atomsI[idx];
-                auto typeI = i->localTypeIndex();
-                auto &j = atomsI[jdx];
-                auto typeJ = j->localTypeIndex();
-                if (typeI != AtomType::Ignore && typeJ != AtomType::Ignore)
+                const auto &centre = cellArray.cell(Vec3<double>(xi, yi, zi))->gridReference();
+                for (auto &&[key, delta] : uniqueDeltas)
                 {
-                    // No need to perform MIM since we're in the same cell
-                    partialSet.fullHistogram(i->localTypeIndex(), j->localTypeIndex()).bin((i->r() - j->r()).magnitude());
+                    auto cellIndex = cellArray.cell(centre.x + delta.x, centre.y + delta.y, centre.z + delta.z)->index();
+                    auto begin = coordinates.cellBegin[cellIndex], nJ = coordinates.cellBegin[cellIndex + 1] - begin;
+                    bins.resize(nJ);
+                    calculateBinIndices(mim, xi, yi, zi, coordinates.x.data() + begin, coordinates.y.data() + begin,
+                                        coordinates.z.data() + begin, nJ, rMinimum, binWidth, bins.data());
+
+                    // Pairs of moved atoms are considered only once, from the lower index
+                    for (auto n = 0; n < nJ; ++n)
+                    {
+                        auto j = coordinates.indices[begin + n];
+                        if (j == i || types[j] == AtomType::Ignore || (isMoved[j] && j < i))
+                            continue;
+
+                        auto &histogram = histograms[{typeI, types[j]}];
+                        if (add)
+                            histogram.binIndex(bins[n]);
+                        else
+                            histogram.unbinIndex(bins[n]);
+                    }
                 }
-            });
-    }
+            };
+
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(start),
+                               dissolve::counting_iterator<int>(end),
+                               [&](const auto idx)
+                               {
+                                   auto i = moved[idx];
+                                   auto typeI = types[i];
+                                   if (typeI == AtomType::Ignore)
+                                       return;
+
+                                   auto &histograms = combinableHistograms.local();
+                                   auto &bins = combinableBinIndices.local();
+                                   binAgainstNeighbours(i, typeI, oldCoordinates, reference.x[i], reference.y[i],
+                                                        reference.z[i], histograms, bins, false);
+                                   binAgainstNeighbours(i, typeI, newCoordinates, x[i], y[i], z[i], histograms, bins, true);
+                               });
+        });
+    auto deltas = combinableHistograms.finalize();
+
+    // Sum changes from all processes and apply them to the reference histograms
+    for (auto typeI = 0; typeI < partialSet.nAtomTypes(); ++typeI)
+        for (auto typeJ = typeI; typeJ < partialSet.nAtomTypes(); ++typeJ)
+        {
+            if (!deltas[{typeI, typeJ}].allSum(procPool))
+                return false;
+            auto &histogram = partialSet.fullHistogram(typeI, typeJ);
+            histogram = reference.fullHistograms[{typeI, typeJ}];
+            histogram.add(deltas[{typeI, typeJ}]);
+        }
+
+    // Record the cost per moved atom for future decisions
+    timer.stop();
+    if (!moved.empty())
+        reference.movedAtomTime = timer.secondsElapsed() / moved.size();
+
     return true;
 }
 
+// Store incremental reference data for the specified Configuration
+void GRModule::storeIncrementalReference(Configuration *cfg, PartialSet &partialSet, const double rdfRange,
+                                         const double rdfBinWidth)
+{
+    auto &reference = incrementalReferences_[cfg];
+    reference.rdfRange = rdfRange;
+    reference.binWidth = rdfBinWidth;
+    reference.boxLengths = cfg->box()->axisLengths();
+    reference.boxAngles = cfg->box()->axisAngles();
+
+    const auto &atoms = cfg->atoms();
+    reference.x.resize(atoms.size());
+    reference.y.resize(atoms.size());
+    reference.z.resize(atoms.size());
+    reference.types.resize(atoms.size());
+    for (auto &&[i, x, y, z, type] : zip(atoms, reference.x, reference.y, reference.z, reference.types))
+    {
+        x = i.r().x;
+        y = i.r().y;
+        z = i.r().z;
+        type = i.localTypeIndex();
+    }
+
+    reference.fullHistograms.initialise(partialSet.nAtomTypes(), partialSet.nAtomTypes(), true);
+    for (auto typeI = 0; typeI < partialSet.nAtomTypes(); ++typeI)
+        for (auto typeJ = typeI; typeJ < partialSet.nAtomTypes(); ++typeJ)
+            reference.fullHistograms[{typeI, typeJ}] = partialSet.fullHistogram(typeI, typeJ);
+}
+
 /*
  * Public Functions
  */
@@ -359,7 +617,13 @@ bool GRModule::calculateGR(GenericList &processingData, const ProcessPool &procP
      */
 
     Timer timer;
-    if (method == GRModule::TestMethod)
+    auto incrementalUpdate = incremental_ && method != GRModule::TestMethod &&
+                             calculateGRIncremental(procPool, cfg, originalgr, rdfRange, rdfBinWidth);
+    if (incrementalUpdate)
+    {
+        // Full histograms are complete and already summed over all processes
+    }
+    else if (method == GRModule::TestMethod)
         calculateGRTestSerial(cfg, originalgr);
     else if (method == GRModule::SimpleMethod)
         calculateGRSimple(procPool, cfg, originalgr, rdfBinWidth);
@@ -372,6 +636,8 @@ bool GRModule::calculateGR(GenericList &processingData, const ProcessPool &procP
     }
     timer.stop();
     Messenger::print("Finished calculation of partials ({} elapsed).\n", timer.totalTimeString());
+    if (incremental_ && !incrementalUpdate && method != GRModule::TestMethod)
+        incrementalReferences_[cfg].fullTime = timer.secondsElapsed();
 
     /*
      * Calculate intramolecular partials
@@ -426,13 +692,15 @@ bool GRModule::calculateGR(GenericList &processingData, const ProcessPool &procP
     Timer commsTimer(false);
     auto success =
         for_each_pair_early(0, originalgr.nAtomTypes(),
-                            [&originalgr, &procPool, &commsTimer, method](auto typeI, auto typeJ) -> EarlyReturn<bool>
+                            [&originalgr, &procPool, &commsTimer, method, incrementalUpdate](auto typeI,
+                                                                                             auto typeJ) -> EarlyReturn<bool>
                             {
                                 // Sum histogram data from all processes (except if using GRModule::TestMethod, where all
-                                // processes have all data already)
+                                // processes have all data already, or for full histograms updated incrementally)
                                 if (method != GRModule::TestMethod)
                                 {
-                                    if (!originalgr.fullHistogram(typeI, typeJ).allSum(procPool, commsTimer))
+                                    if (!incrementalUpdate &&
+                                        !originalgr.fullHistogram(typeI, typeJ).allSum(procPool, commsTimer))
                                         return false;
                                     if (!originalgr.boundHistogram(typeI, typeJ).allSum(procPool, commsTimer))
                                         return false;
@@ -447,6 +715,10 @@ bool GRModule::calculateGR(GenericList &processingData, const ProcessPool &procP
     if (success.has_value() && !success.value())
         return false;
 
+    // Store reference data for subsequent incremental updates
+    if (incremental_ && method != GRModule::TestMethod)
+        storeIncrementalReference(cfg, originalgr, rdfRange, rdfBinWidth);
+
     // Transform histogram data into radial distribution functions
     originalgr.formPartials(box->volume());
 
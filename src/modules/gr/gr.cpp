@@ -41,6 +41,10 @@ GRModule::GRModule() : Module(ModuleTypes::GR)
         "InternalTest",
         "Perform internal check of calculated partials against a set calculated by a simple unoptimised double-loop",
         internalTest_);
+    keywords_.add<BoolKeyword>(
+        "Incremental",
+        "Update full partials incrementally from only those atoms which have moved since the last calculation, where possible",
+        incremental_);
     keywords_.add<EnumOptionsKeyword<GRModule::PartialsMethod>>(
         "Method", "Calculation method for partial radial distribution functions", partialsMethod_, GRModule::partialsMethods());
 
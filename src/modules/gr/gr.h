@@ -7,6 +7,7 @@
 #include "math/averaging.h"
 #include "math/function1D.h"
 #include "module/module.h"
+#include <map>
 
 // Forward Declarations
 class Dissolve;
@@ -47,6 +48,8 @@ class GRModule : public Module
     double binWidth_{0.025};
     // Perform internal check of calculated partials against a set calculated by a simple unoptimised double-loop
     bool internalTest_{false};
+    // Whether to update full partials incrementally from atoms moved since the last calculation, where possible
+    bool incremental_{false};
     // Type of broadening to apply to intramolecular g(r)
     Function1DWrapper intraBroadening_{Functions1D::Form::Gaussian, {0.18}};
     // Degree of smoothing to apply
@@ -63,6 +66,25 @@ class GRModule : public Module
     /*
      * Functions
      */
+    private:
+    // Reference data from which full partial histograms can be updated incrementally
+    struct IncrementalReference
+    {
+        // Range and bin width of histograms
+        double rdfRange{0.0}, binWidth{0.0};
+        // Box lengths and angles
+        Vec3<double> boxLengths, boxAngles;
+        // Atom coordinates and local atom type indices, in Configuration order
+        std::vector<double> x, y, z;
+        std::vector<int> types;
+        // Full partial histograms
+        Array2D<Histogram1D> fullHistograms;
+        // Time taken (seconds) by the last full calculation, and per moved atom by the last incremental update
+        double fullTime{0.0}, movedAtomTime{0.0};
+    };
+    // Incremental reference data for target Configurations
+    std::map<const Configuration *, IncrementalReference> incrementalReferences_;
+
     private:
     // Calculate partial g(r) in serial with simple double-loop
     bool calculateGRTestSerial(Configuration *cfg, PartialSet &partialSet);
@@ -70,6 +92,12 @@ class GRModule : public Module
     bool calculateGRSimple(const ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange);
     // Calculate partial g(r) utilising Cell neighbour lists
     bool calculateGRCells(const ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double binWidth);
+    // Update full partial g(r) from reference data using only atoms which have moved, returning false if not possible
+    bool calculateGRIncremental(const ProcessPool &procPool, Configuration *cfg, PartialSet &partialSet, const double rdfRange,
+                                const double rdfBinWidth);
+    // Store incremental reference data for the specified Configuration
+    void storeIncrementalReference(Configuration *cfg, PartialSet &partialSet, const double rdfRange,
+                                   const double rdfBinWidth);
 
     public:
     // Calculate and return effective density based on target Configurations
@@ -4,6 +4,7 @@
 #include "modules/importTrajectory/importTrajectory.h"
 #include "keywords/configuration.h"
 #include "keywords/fileAndFormat.h"
+#include "keywords/integer.h"
 
 ImportTrajectoryModule::ImportTrajectoryModule() : Module(ModuleTypes::ImportTrajectory)
 {
@@ -13,5 +14,10 @@ ImportTrajectoryModule::ImportTrajectoryModule() : Module(ModuleTypes::ImportTra
     keywords_.setOrganisation("Options", "File");
     keywords_.add<FileAndFormatKeyword>("Format", "File / format for trajectory", trajectoryFormat_, "EndFormat");
 
+    keywords_.setOrganisation("Options", "Control");
+    keywords_.add<IntegerKeyword>("NFrames",
+                                  "Number of frames to read per iteration, storing snapshots of each for analysis as a batch",
+                                  nFrames_, 1);
+
     executeIfTargetsUnchanged_ = true;
 }
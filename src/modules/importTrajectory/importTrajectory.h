@@ -4,6 +4,7 @@
 #pragma once
 
 #include "io/import/trajectory.h"
+#include "io/import/trajectoryReader.h"
 #include "module/module.h"
 
 // Import Trajectory Module
@@ -21,6 +22,10 @@ class ImportTrajectoryModule : public Module
     Configuration *targetConfiguration_{nullptr};
     // Trajectory file source
     TrajectoryImportFileFormat trajectoryFormat_;
+    // Indexed reader for trajectory file
+    TrajectoryReader trajectoryReader_;
+    // Number of frames to read per iteration
+    int nFrames_{1};
 
     /*
      * Processing
@@ -28,4 +33,8 @@ class ImportTrajectoryModule : public Module
     private:
     // Run main processing
     Module::ExecutionResult process(ModuleContext &moduleContext) override;
+
+    public:
+    // Run set-up stage
+    bool setUp(ModuleContext &moduleContext, Flags<KeywordBase::KeywordSignal> actionSignals) override;
 };
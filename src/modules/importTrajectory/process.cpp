@@ -1,12 +1,37 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
-#include "base/lineParser.h"
 #include "base/sysFunc.h"
 #include "classes/configuration.h"
 #include "main/dissolve.h"
 #include "module/context.h"
 #include "modules/importTrajectory/importTrajectory.h"
+#include <algorithm>
+
+// Run set-up stage
+bool ImportTrajectoryModule::setUp(ModuleContext &moduleContext, Flags<KeywordBase::KeywordSignal> actionSignals)
+{
+    if (nFrames_ <= 1 || !targetConfiguration_)
+        return true;
+
+    // Only SiteRDF analyses every frame of a batch - any other module targeting the configuration would see only the last
+    for (auto *module : moduleContext.dissolve().coreData().moduleInstances())
+    {
+        if (module == this || !module->isEnabled() || module->type() == ModuleTypes::SiteRDF)
+            continue;
+
+        auto targets = module->keywords().find("Configurations") ? module->keywords().getVectorConfiguration("Configurations")
+                                                                 : std::vector<Configuration *>();
+        if (module->keywords().find("Configuration"))
+            targets.push_back(module->keywords().getConfiguration("Configuration"));
+        if (std::find(targets.begin(), targets.end(), targetConfiguration_) != targets.end())
+            return Messenger::error("[SETUP {}] Module '{}' targets configuration '{}' but can't analyse a batch of frames - "
+                                    "set NFrames to 1 or remove it.\n",
+                                    name_, module->name(), targetConfiguration_->name());
+    }
+
+    return true;
+}
 
 // Run main processing
 Module::ExecutionResult ImportTrajectoryModule::process(ModuleContext &moduleContext)
@@ -14,50 +39,114 @@ Module::ExecutionResult ImportTrajectoryModule::process(ModuleContext &moduleCon
     Messenger::print("Import: Reading trajectory file frame from '{}' into Configuration '{}'...\n",
                      trajectoryFormat_.filename(), targetConfiguration_->name());
 
-    // Open the file
-    LineParser parser(&moduleContext.processPool());
-    if ((!parser.openInput(trajectoryFormat_.filename())) || (!parser.isFileGoodForReading()))
-    {
-        Messenger::error("Couldn't open trajectory file '{}'.\n", trajectoryFormat_.filename());
-        return ExecutionResult::Failed;
-    }
+    auto &procPool = moduleContext.processPool();
+    auto &processingData = moduleContext.dissolve().processingModuleData();
 
-    // Does a seek position exist in the processing module info?
+    // Retrieve the index of the next frame to read
+    std::string frameName = fmt::format("TrajectoryFrame_{}", targetConfiguration_->niceName());
     std::string streamPosName = fmt::format("TrajectoryPosition_{}", targetConfiguration_->niceName());
-    if (moduleContext.dissolve().processingModuleData().contains(streamPosName, name()))
-    {
-        // Retrieve the streampos and go to it in the file
-        std::streampos trajPos =
-            moduleContext.dissolve().processingModuleData().retrieve<std::streampos>(streamPosName, name());
-        parser.seekg(trajPos);
-    }
+    auto hasFrameIndex = processingData.contains(frameName, name());
+    auto &frameIndex = processingData.realise<int>(frameName, name(), GenericItem::InRestartFileFlag);
+
+    // Snapshots are only stored if a batch of frames is being read
+    targetConfiguration_->clearSnapshots();
 
-    // Read the frame
-    std::optional<Matrix3> unitCell;
-    if (!trajectoryFormat_.importData(parser, targetConfiguration_, unitCell))
+    auto clearExistingLocations = false;
+    for (auto i = 0; i < nFrames_; ++i)
     {
-        Messenger::error("Failed to read trajectory frame data.\n");
-        return ExecutionResult::Failed;
-    }
+        // Only the pool master reads the file, broadcasting the frame and its index to the other processes
+        std::vector<double> r;
+        std::array<double, 9> axes;
+        auto hasUnitCell = false;
+        if (procPool.isMaster())
+        {
+            // (Re)open and index the trajectory if necessary
+            auto format = trajectoryFormat_.format();
+            if (!format || (!trajectoryReader_.isOpen(trajectoryFormat_.filename(), *format) &&
+                            !trajectoryReader_.open(trajectoryFormat_.filename(), *format)))
+            {
+                Messenger::error("Couldn't open trajectory file '{}'.\n", trajectoryFormat_.filename());
+                procPool.decideFalse();
+                return ExecutionResult::Failed;
+            }
 
-    targetConfiguration_->incrementContentsVersion();
+            // Convert any file position from a restart file written by older versions into a frame index
+            if (!hasFrameIndex && processingData.contains(streamPosName, name()))
+            {
+                auto streamPos = processingData.retrieve<std::streampos>(streamPosName, name());
+                frameIndex = trajectoryReader_.frameAt(static_cast<std::size_t>(streamPos)).value_or(0);
+                hasFrameIndex = true;
+            }
 
-    // Set the trajectory file position in the restart file
-    moduleContext.dissolve().processingModuleData().realise<std::streampos>(streamPosName, name(),
-                                                                            GenericItem::InRestartFileFlag) = parser.tellg();
+            // Read the frame, and start reading the next one while this one is in use
+            auto frame = trajectoryReader_.read(frameIndex);
+            if (!frame)
+            {
+                Messenger::error("Failed to read trajectory frame {} (of {}).\n", frameIndex + 1, trajectoryReader_.nFrames());
+                procPool.decideFalse();
+                return ExecutionResult::Failed;
+            }
+            trajectoryReader_.prefetch(frameIndex + 1);
+            if (frame->r.size() != targetConfiguration_->nAtoms())
+            {
+                Messenger::error("Trajectory frame contains {} atoms but the configuration has {}.\n", frame->r.size(),
+                                 targetConfiguration_->nAtoms());
+                procPool.decideFalse();
+                return ExecutionResult::Failed;
+            }
 
-    // Handle the unit cell if one was provided
-    auto clearExistingLocations = false;
-    if (unitCell)
-    {
-        // Check that the unit cell has changed by an appreciable amount....
-        if ((unitCell.value() - targetConfiguration_->box()->axes()).maxAbs() > 1.0e-8)
+            r.resize(frame->r.size() * 3);
+            for (auto n = 0; n < frame->r.size(); ++n)
+            {
+                r[n * 3] = frame->r[n].x;
+                r[n * 3 + 1] = frame->r[n].y;
+                r[n * 3 + 2] = frame->r[n].z;
+            }
+            hasUnitCell = frame->unitCell.has_value();
+            if (hasUnitCell)
+                axes = frame->unitCell->matrix();
+
+            procPool.decideTrue();
+        }
+        else if (!procPool.decision())
+            return ExecutionResult::Failed;
+        r.resize(targetConfiguration_->nAtoms() * 3);
+        if (!procPool.broadcast(r) || !procPool.broadcast(hasUnitCell) || !procPool.broadcast(axes.data(), axes.size()) ||
+            !procPool.broadcast(frameIndex))
+            return ExecutionResult::Failed;
+
+        // Any file position from an older restart file has now been converted, so stop it being written back out
+        if (processingData.contains(streamPosName, name()))
+            processingData.remove(streamPosName, name());
+
+        // Set the atom coordinates
+        for (auto n = 0; n < targetConfiguration_->nAtoms(); ++n)
+            targetConfiguration_->atom(n).setCoordinates(r[n * 3], r[n * 3 + 1], r[n * 3 + 2]);
+
+        targetConfiguration_->incrementContentsVersion();
+
+        // Move on to the next frame
+        ++frameIndex;
+
+        // Handle the unit cell if one was provided
+        if (hasUnitCell)
         {
-            // Create new Box and cells for the configuration
-            targetConfiguration_->createBoxAndCells(unitCell.value(), moduleContext.dissolve().pairPotentialRange());
+            Matrix3 unitCell;
+            std::copy(axes.begin(), axes.end(), &unitCell[0]);
+
+            // Check that the unit cell has changed by an appreciable amount....
+            if ((unitCell - targetConfiguration_->box()->axes()).maxAbs() > 1.0e-8)
+            {
+                // Create new Box and cells for the configuration
+                targetConfiguration_->createBoxAndCells(unitCell, moduleContext.dissolve().pairPotentialRange());
 
-            clearExistingLocations = true;
+                clearExistingLocations = true;
+            }
         }
+
+        // Store a snapshot of the frame for analysis
+        if (nFrames_ > 1)
+            targetConfiguration_->addSnapshot();
     }
 
     // Make sure that the configuration contents are up-to-date w.r.t. cell locations etc.
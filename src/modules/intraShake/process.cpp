@@ -1,7 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "base/sysFunc.h"
 #include "classes/box.h"
 #include "classes/changeStore.h"
@@ -59,8 +59,8 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
     auto kernel = KernelProducer::energyKernel(targetConfiguration_, moduleContext.processPool(),
                                                moduleContext.dissolve().potentialMap(), rCut);
 
-    // Initialise the random number buffer
-    RandomBuffer randomBuffer(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
+    // Initialise the random number stream
+    RandomStream randomStream(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
 
     // Determine target molecules from the restrictedSpecies vector (if any) and give to the distributor
     if (!restrictToSpecies_.empty())
@@ -108,8 +108,8 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
             // Set the new strategy
             strategy = distributor.currentStrategy();
 
-            // Re-initialise the random buffer
-            randomBuffer.reset(ProcessPool::subDivisionStrategy(strategy));
+            // Re-initialise the random stream
+            randomStream.reset(ProcessPool::subDivisionStrategy(strategy));
         }
 
         // Loop over target Molecule
@@ -142,7 +142,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                     intraEnergy = bond.inCycle() ? kernel->totalGeometryEnergy(*mol) : kernel->bondEnergy(bond, *i, *j);
 
                     // Select random terminus
-                    terminus = randomBuffer.random() > 0.5 ? 1 : 0;
+                    terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                     // Loop over number of shakes per term
                     for (shake = 0; shake < nShakesPerTerm_; ++shake)
@@ -150,7 +150,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                         // Get translation vector, normalise, and apply random delta
                         vji = box->minimumVector(i->r(), j->r());
                         vji.normalise();
-                        vji *= randomBuffer.randomPlusMinusOne() * bondStepSize_;
+                        vji *= randomStream.randomPlusMinusOne() * bondStepSize_;
 
                         // Adjust the Atoms attached to the selected terminus
                         mol->translate(vji, bond.attachedAtoms(terminus));
@@ -164,7 +164,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
 
                         // Trial the transformed Molecule
                         delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                        accept = delta < 0 ? true : (randomBuffer.random() < exp(-delta * rRT));
+                        accept = delta < 0 ? true : (randomStream.random() < exp(-delta * rRT));
 
                         // Accept new (current) positions of the Molecule's Atoms?
                         if (accept)
@@ -195,7 +195,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                     intraEnergy = angle.inCycle() ? kernel->totalGeometryEnergy(*mol) : kernel->angleEnergy(angle, *i, *j, *k);
 
                     // Select random terminus
-                    terminus = randomBuffer.random() > 0.5 ? 1 : 0;
+                    terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                     // Loop over number of shakes per term
                     for (shake = 0; shake < nShakesPerTerm_; ++shake)
@@ -206,7 +206,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                         v = vji * vjk;
 
                         // Create suitable transformation matrix
-                        transform.createRotationAxis(v, randomBuffer.randomPlusMinusOne() * angleStepSize_, true);
+                        transform.createRotationAxis(v, randomStream.randomPlusMinusOne() * angleStepSize_, true);
 
                         // Adjust the Atoms attached to the selected terminus
                         mol->transform(box, transform, j->r(), angle.attachedAtoms(terminus));
@@ -221,7 +221,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
 
                         // Trial the transformed Molecule
                         delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                        accept = delta < 0 || (randomBuffer.random() < exp(-delta * rRT));
+                        accept = delta < 0 || (randomStream.random() < exp(-delta * rRT));
 
                         // Accept new (current) positions of the Molecule's Atoms?
                         if (accept)
@@ -257,7 +257,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                     intraEnergy = kernel->torsionEnergy(torsion, *i, *j, *k, *l);
 
                     // Select random terminus
-                    terminus = randomBuffer.random() > 0.5 ? 1 : 0;
+                    terminus = randomStream.random() > 0.5 ? 1 : 0;
 
                     // Loop over number of shakes per term
                     for (shake = 0; shake < nShakesPerTerm_; ++shake)
@@ -266,7 +266,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
                         vjk = box->minimumVector(j->r(), k->r());
 
                         // Create suitable transformation matrix
-                        transform.createRotationAxis(vjk, randomBuffer.randomPlusMinusOne() * torsionStepSize_, true);
+                        transform.createRotationAxis(vjk, randomStream.randomPlusMinusOne() * torsionStepSize_, true);
 
                         // Adjust the Atoms attached to the selected terminus
                         mol->transform(box, transform, terminus == 0 ? j->r() : k->r(), torsion.attachedAtoms(terminus));
@@ -280,7 +280,7 @@ Module::ExecutionResult IntraShakeModule::process(ModuleContext &moduleContext)
 
                         // Trial the transformed Molecule
                         delta = (newPPEnergy + newIntraEnergy) - (ppEnergy + intraEnergy);
-                        accept = delta < 0 || (randomBuffer.random() < exp(-delta * rRT));
+                        accept = delta < 0 || (randomStream.random() < exp(-delta * rRT));
 
                         // Accept new (current) positions of the Molecule's Atoms?
                         if (accept)
@@ -7,26 +7,49 @@
 #include "modules/forces/forces.h"
 #include "modules/md/md.h"
 
-// Cap forces in Configuration
-int MDModule::capForces(double maxForce, std::vector<Vec3<double>> &fInter, std::vector<Vec3<double>> &fIntra)
+// Cap forces on a single atom, returning whether capping was necessary
+bool MDModule::capForces(double maxForce, Vec3<double> &fInter, Vec3<double> &fIntra)
 {
-    double fMag;
-    const auto maxForceSq = maxForce * maxForce;
-    auto nCapped = 0;
-    for (auto &&[inter, intra] : zip(fInter, fIntra))
-    {
-        fMag = (inter + intra).magnitudeSq();
-        if (fMag < maxForceSq)
-            continue;
+    auto fMag = (fInter + fIntra).magnitudeSq();
+    if (fMag < maxForce * maxForce)
+        return false;
 
-        fMag = maxForce / sqrt(fMag);
-        inter *= fMag;
-        intra *= fMag;
+    fMag = maxForce / sqrt(fMag);
+    fInter *= fMag;
+    fIntra *= fMag;
 
-        ++nCapped;
-    }
+    return true;
+}
 
-    return nCapped;
+// Return velocity scaling factor to apply from the specified thermostat, given the instantaneous temperature after a step
+double MDModule::thermostatScaling(ThermostatType thermostat, double deltaT, double timeConstant, double temperature,
+                                   double tInstant, double &xi)
+{
+    switch (thermostat)
+    {
+        case (ThermostatType::Rescale):
+            return sqrt(temperature / tInstant);
+        case (ThermostatType::Berendsen):
+        {
+            // Limit the coupling to a full rescale so that time constants shorter than the timestep cannot overshoot
+            auto coupling = std::min(deltaT / timeConstant, 1.0);
+            return sqrt(1.0 + coupling * (temperature / tInstant - 1.0));
+        }
+        case (ThermostatType::NoseHoover):
+        {
+            // Propagate the thermostat over the whole step with a symmetric splitting - advance the friction coefficient by
+            // a half step, scale the velocities, then advance the friction coefficient by a half step using the scaled
+            // temperature. The thermostat mass is expressed through its time constant.
+            auto qInv = 1.0 / (timeConstant * timeConstant);
+            xi += 0.5 * deltaT * (tInstant / temperature - 1.0) * qInv;
+            auto scale = exp(-xi * deltaT);
+            xi += 0.5 * deltaT * (tInstant * scale * scale / temperature - 1.0) * qInv;
+            return scale;
+        }
+        default:
+            // Langevin dynamics are thermostatted within the propagation
+            return 1.0;
+    }
 }
 
 // Determine timestep to use
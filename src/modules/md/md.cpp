@@ -20,6 +20,15 @@ MDModule::MDModule() : Module(ModuleTypes::MD)
     keywords_.add<EnumOptionsKeyword<MDModule::TimestepType>>("Timestep", "Timestep type to use in calculation", timestepType_,
                                                               MDModule::timestepType());
     keywords_.add<DoubleKeyword>("DeltaT", "Fixed timestep (ps) to use in MD simulation", fixedTimestep_, 0.0);
+    keywords_.add<IntegerKeyword>("RESPASteps",
+                                  "Number of inner timesteps over bound (geometry) forces per outer timestep over unbound "
+                                  "forces, using multiple-time-step (RESPA) integration (1 for standard velocity Verlet)",
+                                  nRESPASteps_, 1);
+    keywords_.add<EnumOptionsKeyword<MDModule::ThermostatType>>("Thermostat", "Thermostat to use in calculation", thermostat_,
+                                                                MDModule::thermostatType());
+    keywords_.add<DoubleKeyword>("ThermostatTimeConstant",
+                                 "Coupling time constant (ps) for the thermostat (inverse friction for Langevin dynamics)",
+                                 thermostatTimeConstant_, 1.0e-5);
     keywords_.add<BoolKeyword>("RandomVelocities",
                                "Whether random velocities should always be assigned before beginning MD simulation",
                                randomVelocities_);
@@ -38,6 +47,9 @@ MDModule::MDModule() : Module(ModuleTypes::MD)
                                           0, std::nullopt, 5, "Off");
     keywords_.add<OptionalIntegerKeyword>("TrajectoryFrequency", "Write frequency for trajectory file", trajectoryFrequency_, 0,
                                           std::nullopt, 5, "Off");
+    keywords_.add<EnumOptionsKeyword<TrajectoryExportFileFormat::TrajectoryExportFormat>>(
+        "TrajectoryFormat", "Format for trajectory file", trajectoryFormat_,
+        TrajectoryExportFileFormat::trajectoryExportFormats());
 
     keywords_.setOrganisation("Advanced");
     keywords_.add<BoolKeyword>("CapForces", "Control whether atomic forces are capped every step", capForces_);
@@ -45,10 +57,18 @@ MDModule::MDModule() : Module(ModuleTypes::MD)
     keywords_.add<OptionalDoubleKeyword>(
         "CutoffDistance", "Interatomic cutoff distance to use for energy calculation (0.0 to use pair potential range)",
         cutoffDistance_, 0.0, std::nullopt, 0.1, "Use PairPotential Range");
+    keywords_.add<OptionalDoubleKeyword>(
+        "NeighbourListSkin",
+        "Skin distance for the Verlet neighbour list used in intermolecular force calculation (0.0 to use cells every step)",
+        neighbourListSkin_, 0.0, std::nullopt, 0.1, "Off");
     keywords_.add<BoolKeyword>(
         "IntraOnly",
         "Only forces arising from intramolecular terms (including pair potential contributions) will be calculated",
         intramolecularForcesOnly_);
+    keywords_.add<BoolKeyword>("OwnerComputes",
+                               "Whether each process should calculate final forces for, and integrate, only the atoms within "
+                               "its own cells, rather than summing forces on all atoms over all processes",
+                               ownerComputes_);
 
     // Deprecated
     static bool deprecatedBool_{false};
@@ -66,3 +86,12 @@ EnumOptions<MDModule::TimestepType> MDModule::timestepType()
         "TimestepType",
         {{TimestepType::Fixed, "Fixed"}, {TimestepType::Variable, "Variable"}, {TimestepType::Automatic, "Auto"}});
 }
+
+// Return enum options for ThermostatType
+EnumOptions<MDModule::ThermostatType> MDModule::thermostatType()
+{
+    return EnumOptions<MDModule::ThermostatType>("ThermostatType", {{ThermostatType::Rescale, "Rescale"},
+                                                                    {ThermostatType::Berendsen, "Berendsen"},
+                                                                    {ThermostatType::Langevin, "Langevin"},
+                                                                    {ThermostatType::NoseHoover, "NoseHoover"}});
+}
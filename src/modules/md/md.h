@@ -4,6 +4,7 @@
 #pragma once
 
 #include "base/enumOptions.h"
+#include "io/export/trajectory.h"
 #include "module/module.h"
 
 // Forward Declarations
@@ -30,6 +31,16 @@ class MDModule : public Module
     };
     // Return enum options for TimestepType
     static EnumOptions<TimestepType> timestepType();
+    // Thermostat Type
+    enum class ThermostatType
+    {
+        Rescale,
+        Berendsen,
+        Langevin,
+        NoseHoover
+    };
+    // Return enum options for ThermostatType
+    static EnumOptions<ThermostatType> thermostatType();
 
     private:
     // Target configurations
@@ -48,31 +59,47 @@ class MDModule : public Module
     std::optional<int> energyFrequency_{10};
     // Whether to restrict force calculation to intramolecular contributions only
     bool intramolecularForcesOnly_{false};
+    // Skin distance for Verlet neighbour list used in intermolecular force calculation
+    std::optional<double> neighbourListSkin_;
     // Number of steps to perform
     int nSteps_{50};
+    // Number of inner (bound force) timesteps per outer (unbound force) timestep in multiple-time-step integration
+    int nRESPASteps_{1};
     // Only run MD when target Configuration energies are stable
     bool onlyWhenEnergyStable_{true};
     // Frequency at which to output step information
     std::optional<int> outputFrequency_{5};
+    // Whether each process calculates final forces for, and integrates, only the atoms within its own cells
+    bool ownerComputes_{false};
     // Whether random velocities should always be assigned before beginning MD simulation
     bool randomVelocities_{false};
     // Species to restrict calculation to
     std::vector<const Species *> restrictToSpecies_;
+    // Thermostat to employ
+    ThermostatType thermostat_{ThermostatType::Rescale};
+    // Thermostat coupling time constant (ps)
+    double thermostatTimeConstant_{0.1};
     // Write frequency for trajectory file
     std::optional<int> trajectoryFrequency_;
+    // Format for trajectory file
+    TrajectoryExportFileFormat::TrajectoryExportFormat trajectoryFormat_{
+        TrajectoryExportFileFormat::TrajectoryExportFormat::XYZ};
 
     /*
      * Functions
      */
     private:
-    // Cap forces in Configuration
-    static int capForces(double maxForceSq, std::vector<Vec3<double>> &fInter, std::vector<Vec3<double>> &fIntra);
+    // Cap forces on a single atom, returning whether capping was necessary
+    static bool capForces(double maxForce, Vec3<double> &fInter, Vec3<double> &fIntra);
     // Determine timestep to use
     static std::optional<double> determineTimeStep(TimestepType timestepType, double requestedTimeStep,
                                                    const std::vector<Vec3<double>> &fInter,
                                                    const std::vector<Vec3<double>> &fIntra);
 
     public:
+    // Return velocity scaling factor to apply from the specified thermostat, given the instantaneous temperature after a step
+    static double thermostatScaling(ThermostatType thermostat, double deltaT, double timeConstant, double temperature,
+                                    double tInstant, double &xi);
     // Evolve Species coordinates, returning new coordinates
     static std::vector<Vec3<double>> evolve(const ProcessPool &procPool, const PotentialMap &potentialMap, const Species *sp,
                                             double temperature, int nSteps, double maxDeltaT,
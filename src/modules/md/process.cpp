@@ -2,9 +2,11 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "base/lineParser.h"
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "base/timer.h"
+#include "classes/atomOwnership.h"
 #include "data/atomicMasses.h"
+#include "io/export/trajectory.h"
 #include "main/dissolve.h"
 #include "module/context.h"
 #include "modules/energy/energy.h"
@@ -27,12 +29,32 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
     Messenger::print("MD: Cutoff distance is {}\n", rCut);
     Messenger::print("MD: Number of steps = {}\n", nSteps_);
     Messenger::print("MD: Timestep type is '{}'\n", timestepType().keyword(timestepType_));
+    Messenger::print("MD: Thermostat is '{}' (time constant = {} ps)\n", thermostatType().keyword(thermostat_),
+                     thermostatTimeConstant_);
+    auto useRESPA = nRESPASteps_ > 1 && !intramolecularForcesOnly_;
+    if (useRESPA)
+        Messenger::print("MD: Multiple-time-step (RESPA) integration will be used, with {} bound force step(s) per timestep.\n",
+                         nRESPASteps_);
+    auto ownerComputes = ownerComputes_ && moduleContext.processPool().nProcesses() > 1;
+    if (ownerComputes && (useRESPA || timestepType_ != TimestepType::Fixed || !restrictToSpecies_.empty()))
+    {
+        Messenger::warn("Owner-computes mode requires a fixed timestep with no RESPA integration or species restriction, and "
+                        "will not be used.\n");
+        ownerComputes = false;
+    }
+    if (ownerComputes)
+        Messenger::print("MD: Each process will calculate forces for, and integrate, only the atoms within its own cells.\n");
     if (onlyWhenEnergyStable_)
         Messenger::print("MD: Only perform MD if target Configuration energies are stable.\n");
     if (trajectoryFrequency_.value_or(0) > 0)
-        Messenger::print("MD: Trajectory file will be appended every {} step(s).\n", trajectoryFrequency_.value());
+        Messenger::print("MD: Trajectory file ({}) will be appended every {} step(s).\n",
+                         TrajectoryExportFileFormat::trajectoryExportFormats().option(trajectoryFormat_).description(),
+                         trajectoryFrequency_.value());
     else
         Messenger::print("MD: Trajectory file off.\n");
+    if (neighbourListSkin_ && !intramolecularForcesOnly_)
+        Messenger::print("MD: Neighbour list with skin distance {} will be used for intermolecular forces.\n",
+                         *neighbourListSkin_);
     if (capForces_)
         Messenger::print("MD: Forces will be capped to {:10.3e} kJ/mol per atom per axis.\n", maxForce / 100.0);
     if (energyFrequency_.value_or(0) > 0)
@@ -97,8 +119,8 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
      * Calculation Begins
      */
 
-    // Initialise the random number buffer for all processes
-    RandomBuffer randomBuffer(moduleContext.processPool(), ProcessPool::PoolProcessesCommunicator);
+    // Initialise the random number stream for all processes
+    RandomStream randomStream(moduleContext.processPool(), ProcessPool::PoolProcessesCommunicator);
 
     // Read in or assign random velocities
     auto [velocities, status] = moduleContext.dissolve().processingModuleData().realiseIf<std::vector<Vec3<double>>>(
@@ -114,13 +136,15 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
 
         Messenger::print("Random initial velocities will be assigned.\n");
         velocities.resize(targetConfiguration_->nAtoms(), Vec3<double>());
-        for (auto &&[v, iFree] : zip(velocities, free))
+        std::vector<double> randoms(velocities.size() * 3);
+        randomStream.fill(randoms.data(), randoms.data() + randoms.size());
+        for (auto n = 0; n < velocities.size(); ++n)
         {
-            if (iFree)
-                v.set(exp(randomBuffer.random() - 0.5), exp(randomBuffer.random() - 0.5), exp(randomBuffer.random() - 0.5));
+            if (free[n])
+                velocities[n].set(exp(randoms[n * 3] - 0.5), exp(randoms[n * 3 + 1] - 0.5), exp(randoms[n * 3 + 2] - 0.5));
             else
-                v.zero();
-            v /= sqrt(TWOPI);
+                velocities[n].zero();
+            velocities[n] /= sqrt(TWOPI);
         }
     }
     else if (intramolecularForcesOnly_)
@@ -172,11 +196,14 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
         std::transform(velocities.begin(), velocities.end(), velocities.begin(), [tScale](auto v) { return v * tScale; });
     }
 
-    // Open trajectory file (if requested)
+    // Open trajectory file (if requested) - formats other than plain XYZ are written by a TrajectoryExportFileFormat
     LineParser trajParser;
-    if (trajectoryFrequency_.value_or(0) > 0)
+    auto textTrajectory = trajectoryFormat_ == TrajectoryExportFileFormat::TrajectoryExportFormat::XYZ;
+    std::string trajectoryFile = fmt::format("{}.md.{}", targetConfiguration_->name(),
+                                             TrajectoryExportFileFormat::trajectoryExportFormats().keyword(trajectoryFormat_));
+    TrajectoryExportFileFormat trajectoryExporter(trajectoryFile, trajectoryFormat_);
+    if (trajectoryFrequency_.value_or(0) > 0 && textTrajectory)
     {
-        std::string trajectoryFile = fmt::format("{}.md.xyz", targetConfiguration_->name());
         if (moduleContext.processPool().isMaster())
         {
             if ((!trajParser.appendOutput(trajectoryFile)) || (!trajParser.isFileGoodForWriting()))
@@ -201,11 +228,175 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
                          "deltaT(ps)\n");
     }
 
+    // Retrieve the neighbour list for intermolecular forces (if requested), rebuilding it as atoms move
+    auto useNeighbourList = neighbourListSkin_ && !intramolecularForcesOnly_;
+    auto nNeighbourListBuilds = 0, lastNeighbourListBuild = -1;
+    auto neighbourList = [&]() -> OptionalReferenceWrapper<const NeighbourList>
+    {
+        if (!useNeighbourList)
+            return {};
+        auto &list = targetConfiguration_->neighbourList(moduleContext.dissolve().potentialMap().range(), *neighbourListSkin_);
+        if (list.nBuilds() != lastNeighbourListBuild)
+        {
+            ++nNeighbourListBuilds;
+            lastNeighbourListBuild = list.nBuilds();
+        }
+        return list;
+    };
+
     // Start a timer
     Timer timer, commsTimer(false);
 
-    // If we're not using a fixed timestep the forces need to be available immediately
-    if (timestepType_ != TimestepType::Fixed)
+    // Assign atoms to processes by their cells if each process is to integrate only its own. Each process then needs current
+    // positions only for atoms within the interaction range (plus any neighbour list skin) of its cells, and for the whole of
+    // any molecule whose first atom it owns, allowing molecules to stretch by up to half their current extent.
+    std::optional<AtomOwnership> ownership;
+    if (ownerComputes)
+    {
+        auto haloRange =
+            moduleContext.dissolve().potentialMap().range() + (useNeighbourList ? neighbourListSkin_.value() : 0.0);
+        const auto *box = targetConfiguration_->box();
+        for (const auto &mol : targetConfiguration_->molecules())
+            for (auto n = 1; n < mol->nAtoms(); ++n)
+                haloRange = std::max(haloRange, 1.5 * box->minimumDistance(mol->atom(0)->r(), mol->atom(n)->r()));
+        ownership.emplace(moduleContext.processPool(), targetConfiguration_, haloRange);
+    }
+    auto optionalOwnership = [&ownership]() -> OptionalReferenceWrapper<const AtomOwnership>
+    {
+        if (ownership)
+            return *ownership;
+        return {};
+    };
+
+    // Apply the supplied function to the index of every atom, or only those owned by this process
+    auto forEachAtom = [&](auto function)
+    {
+        if (ownership)
+            dissolve::for_each(ParallelPolicies::par, ownership->ownedAtoms().begin(), ownership->ownedAtoms().end(), function);
+        else
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                               dissolve::counting_iterator<int>(atoms.size()), function);
+    };
+
+    // Send the new positions of owned atoms to the partner processes which need them, handing over atoms (along with their
+    // velocities and accelerations) which have moved into cells owned by another process. Processes which needed the position
+    // of an atom in its previous cell are also sent it, so that they know it has left. Atoms which have moved too far to be
+    // handed over are counted, and cause the dynamics to fail.
+    std::vector<std::vector<double>> outgoingAtoms, incomingAtoms;
+    std::vector<int> recipients, retainedAtoms;
+    auto nLostAtoms = 0;
+    auto exchangeHaloAtoms = [&]()
+    {
+        auto &procPool = moduleContext.processPool();
+        outgoingAtoms.resize(ownership->partners().size());
+        for (auto &buffer : outgoingAtoms)
+            buffer.clear();
+        retainedAtoms.clear();
+        for (auto n : ownership->ownedAtoms())
+        {
+            auto &i = atoms[n];
+            const auto &previousRanks = ownership->haloRanks(i.cell()->index());
+            targetConfiguration_->updateAtomLocation(&i);
+            const auto &currentRanks = ownership->haloRanks(i.cell()->index());
+            auto newOwner = ownership->cellOwner(i.cell()->index());
+            if (newOwner == procPool.poolRank())
+                retainedAtoms.push_back(n);
+
+            recipients.clear();
+            std::set_union(previousRanks.begin(), previousRanks.end(), currentRanks.begin(), currentRanks.end(),
+                           std::back_inserter(recipients));
+            const auto &r = i.r();
+            for (auto rank : recipients)
+            {
+                auto partner = ownership->partnerIndex(rank);
+                if (partner == -1)
+                {
+                    ++nLostAtoms;
+                    continue;
+                }
+
+                // Atoms changing owner are flagged by a negative index
+                auto &buffer = outgoingAtoms[partner];
+                if (rank == newOwner)
+                {
+                    const auto &v = velocities[n], &a = accelerations[n];
+                    buffer.insert(buffer.end(), {-(n + 1.0), r.x, r.y, r.z, v.x, v.y, v.z, a.x, a.y, a.z});
+                }
+                else
+                    buffer.insert(buffer.end(), {double(n), r.x, r.y, r.z});
+            }
+        }
+
+        if (!procPool.exchange(ownership->partners(), outgoingAtoms, incomingAtoms, ProcessPool::PoolProcessesCommunicator,
+                               commsTimer))
+            return false;
+        for (const auto &buffer : incomingAtoms)
+            for (auto it = buffer.begin(); it != buffer.end();)
+            {
+                auto index = int(it[0]);
+                auto n = index < 0 ? -index - 1 : index;
+                atoms[n].setCoordinates(it[1], it[2], it[3]);
+                targetConfiguration_->updateAtomLocation(&atoms[n]);
+                if (index < 0)
+                {
+                    velocities[n].set(it[4], it[5], it[6]);
+                    accelerations[n].set(it[7], it[8], it[9]);
+                    retainedAtoms.push_back(n);
+                    it += 10;
+                }
+                else
+                    it += 4;
+            }
+        ownership->setOwnedAtoms(retainedAtoms);
+
+        return true;
+    };
+
+    // Share the positions (and optionally velocities) of owned atoms with all other processes, so that each holds a complete
+    // and current copy of the configuration
+    auto synchroniseAtoms = [&](bool includeVelocities)
+    {
+        std::vector<double> buffer, gathered;
+        const auto stride = includeVelocities ? 7 : 4;
+        buffer.reserve(ownership->ownedAtoms().size() * stride);
+        for (auto n : ownership->ownedAtoms())
+        {
+            const auto &r = atoms[n].r();
+            buffer.insert(buffer.end(), {double(n), r.x, r.y, r.z});
+            if (includeVelocities)
+                buffer.insert(buffer.end(), {velocities[n].x, velocities[n].y, velocities[n].z});
+        }
+        if (!moduleContext.processPool().allGather(buffer, gathered, ProcessPool::PoolProcessesCommunicator, commsTimer))
+            return false;
+        for (auto it = gathered.cbegin(); it != gathered.cend(); it += stride)
+        {
+            auto n = int(it[0]);
+            atoms[n].setCoordinates(it[1], it[2], it[3]);
+            targetConfiguration_->updateAtomLocation(&atoms[n]);
+            if (includeVelocities)
+                velocities[n].set(it[4], it[5], it[6]);
+        }
+
+        return true;
+    };
+
+    // Calculate bound (geometry) forces only, for the inner steps of RESPA integration
+    auto boundForces = [&]()
+    {
+        if (targetMolecules.empty())
+            ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_,
+                                      moduleContext.dissolve().potentialMap(),
+                                      ForcesModule::ForceCalculationType::IntraMolecularGeometry, fBound, fBound, commsTimer);
+        else
+            ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_, targetMolecules,
+                                      moduleContext.dissolve().potentialMap(),
+                                      ForcesModule::ForceCalculationType::IntraMolecularGeometry, fBound, fBound, commsTimer);
+        std::transform(fBound.begin(), fBound.end(), fBound.begin(), [](auto f) { return f * 100.0; });
+    };
+
+    // If we're not using a fixed timestep (or are using RESPA, which needs the separate contributions) the forces need to be
+    // available immediately
+    if (timestepType_ != TimestepType::Fixed || useRESPA)
     {
         // Zero force arrays
         std::fill(fUnbound.begin(), fUnbound.end(), Vec3<double>());
@@ -216,13 +407,13 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
                                       moduleContext.dissolve().potentialMap(),
                                       intramolecularForcesOnly_ ? ForcesModule::ForceCalculationType::IntraMolecularFull
                                                                 : ForcesModule::ForceCalculationType::Full,
-                                      fUnbound, fBound, commsTimer);
+                                      fUnbound, fBound, commsTimer, neighbourList());
         else
             ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_, targetMolecules,
                                       moduleContext.dissolve().potentialMap(),
                                       intramolecularForcesOnly_ ? ForcesModule::ForceCalculationType::IntraMolecularFull
                                                                 : ForcesModule::ForceCalculationType::Full,
-                                      fUnbound, fBound, commsTimer);
+                                      fUnbound, fBound, commsTimer, neighbourList());
 
         // Must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
         std::transform(fUnbound.begin(), fUnbound.end(), fUnbound.begin(), [](auto f) { return f * 100.0; });
@@ -236,6 +427,26 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
         }
     }
 
+    // Set up the thermostat - velocity scaling determined at the end of each step is deferred to the first propagation pass
+    // of the next, and the Nose-Hoover friction coefficient is retained between runs
+    auto vScale = 1.0;
+    auto &xi = moduleContext.dissolve().processingModuleData().realise<double>(
+        fmt::format("{}//NoseHooverXi", targetConfiguration_->niceName()), name(), GenericItem::InRestartFileFlag);
+    auto langevin = thermostat_ == ThermostatType::Langevin;
+    std::vector<double> randoms(langevin ? targetConfiguration_->nAtoms() * 4 : 0);
+
+    // Langevin (O) step - partially refresh the velocity of an atom from the thermal distribution using four uniform randoms
+    auto langevinStep = [&](const int n, Vec3<double> &v, double deltaT)
+    {
+        if (!free[n])
+            return;
+        const auto c1 = exp(-deltaT / thermostatTimeConstant_);
+        const auto sigma = sqrt((1.0 - c1 * c1) * kb * temperature / mass[n]);
+        auto *u = &randoms[n * 4];
+        auto r1 = sqrt(-2.0 * log(1.0 - u[0])), r2 = sqrt(-2.0 * log(1.0 - u[2]));
+        v = v * c1 + Vec3<double>(r1 * cos(TWOPI * u[1]), r1 * sin(TWOPI * u[1]), r2 * cos(TWOPI * u[3])) * sigma;
+    };
+
     // Ready to do MD propagation of system
     auto step = 1;
     for (step = 1; step <= nSteps_; ++step)
@@ -248,82 +459,185 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
             break;
         }
         auto dT = *optDT;
-        auto deltaTSq = dT * dT;
-
-        // Velocity Verlet first stage (A)
-        // A:  r(t+dt) = r(t) + v(t)*dt + 0.5*a(t)*dt**2
-        // A:  v(t+dt/2) = v(t) + 0.5*a(t)*dt
-        // B:  a(t+dt) = F(t+dt)/m
-        // B:  v(t+dt) = v(t+dt/2) + 0.5*a(t+dt)*dt
-        for (auto &&[i, v, a] : zip(atoms, velocities, accelerations))
+        auto dTInner = dT / nRESPASteps_;
+
+        if (langevin)
+            randomStream.fill(randoms.data(), randoms.data() + randoms.size());
+
+        if (useRESPA)
         {
-            // Propagate positions (by whole step)...
-            i.translateCoordinates(v * dT + a * 0.5 * deltaTSq);
+            // RESPA first stage - half kick from unbound forces, then all but the final inner velocity Verlet step over the
+            // bound forces, which are recalculated at each inner step (Langevin dynamics apply the O step beforehand)
+            // A:  v(t+dt/2) = v(t) + 0.5*fUnbound(t)*dt/m
+            // A:  { v += 0.5*fBound*dti/m; r += v*dti; fBound = F(r); v += 0.5*fBound*dti/m } x (n-1)
+            // A:  v += 0.5*fBound*dti/m; r += v*dti
+            // B:  fUnbound, fBound = F(t+dt)
+            // B:  v(t+dt) = v + 0.5*fBound(t+dt)*dti/m + 0.5*fUnbound(t+dt)*dt/m
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                               dissolve::counting_iterator<int>(atoms.size()),
+                               [&](const auto n)
+                               {
+                                   auto &v = velocities[n];
+                                   v *= vScale;
+                                   if (langevin)
+                                       langevinStep(n, v, dT);
+                                   v += fUnbound[n] * 0.5 * dT / mass[n];
+                               });
+            for (auto inner = 1; inner <= nRESPASteps_; ++inner)
+            {
+                dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                                   dissolve::counting_iterator<int>(atoms.size()),
+                                   [&](const auto n)
+                                   {
+                                       auto &v = velocities[n];
+                                       v += fBound[n] * 0.5 * dTInner / mass[n];
+                                       atoms[n].translateCoordinates(v * dTInner);
+                                   });
+
+                // Bound forces for the final inner step are calculated alongside the unbound forces below
+                if (inner == nRESPASteps_)
+                    break;
+
+                boundForces();
+                dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                                   dissolve::counting_iterator<int>(atoms.size()),
+                                   [&](const auto n) { velocities[n] += fBound[n] * 0.5 * dTInner / mass[n]; });
+            }
 
-            // ...velocities (by half step)...
-            v += a * 0.5 * dT;
+            // Update Atom locations - bound forces depend only on atom coordinates, so this is needed just once per outer step
+            targetConfiguration_->updateAtomLocations();
         }
+        else
+        {
+            // Velocity Verlet first stage (A), applying any pending thermostat scaling and, for Langevin dynamics, the O step
+            // midway through the drift (BAOAB)
+            // A:  v(t+dt/2) = v(t) + 0.5*a(t)*dt
+            // A:  r(t+dt) = r(t) + v(t+dt/2)*dt
+            // B:  a(t+dt) = F(t+dt)/m
+            // B:  v(t+dt) = v(t+dt/2) + 0.5*a(t+dt)*dt
+            forEachAtom(
+                [&](const auto n)
+                {
+                    // Propagate velocities (by half step)...
+                    auto &v = velocities[n];
+                    v = v * vScale + accelerations[n] * 0.5 * dT;
 
-        // Update Atom locations
-        targetConfiguration_->updateAtomLocations();
+                    // ...and positions (by whole step)
+                    if (langevin)
+                    {
+                        auto delta = v * 0.5 * dT;
+                        langevinStep(n, v, dT);
+                        atoms[n].translateCoordinates(delta + v * 0.5 * dT);
+                    }
+                    else
+                        atoms[n].translateCoordinates(v * dT);
+                });
 
-        // Zero force arrays
-        std::fill(fUnbound.begin(), fUnbound.end(), Vec3<double>());
-        std::fill(fBound.begin(), fBound.end(), Vec3<double>());
+            // Update Atom locations
+            if (ownership)
+            {
+                if (!exchangeHaloAtoms())
+                    return ExecutionResult::Failed;
+            }
+            else
+                targetConfiguration_->updateAtomLocations();
+        }
+        vScale = 1.0;
+
+        // Pair potential energy can be accumulated alongside the forces on steps where energy is required, provided that
+        // all atoms and interactions are being considered
+        auto energyStep = energyFrequency_ && (step % energyFrequency_.value() == 0);
+        auto fusedEnergy = energyStep && targetMolecules.empty() && !intramolecularForcesOnly_;
+        ForceKernel::EnergyAndVirial energyAndVirial;
 
-        // Calculate forces - must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
+        // Calculate forces
         if (targetMolecules.empty())
-            ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_,
-                                      moduleContext.dissolve().potentialMap(),
-                                      intramolecularForcesOnly_ ? ForcesModule::ForceCalculationType::IntraMolecularFull
-                                                                : ForcesModule::ForceCalculationType::Full,
-                                      fUnbound, fBound, commsTimer);
+        {
+            if (!ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_,
+                                           moduleContext.dissolve().potentialMap(),
+                                           intramolecularForcesOnly_ ? ForcesModule::ForceCalculationType::IntraMolecularFull
+                                                                     : ForcesModule::ForceCalculationType::Full,
+                                           fUnbound, fBound, commsTimer, neighbourList(),
+                                           fusedEnergy ? OptionalReferenceWrapper<ForceKernel::EnergyAndVirial>(energyAndVirial)
+                                                       : std::nullopt,
+                                           optionalOwnership()))
+            {
+                Messenger::error("Failed to exchange forces on owned atoms. Stopping evolution.\n");
+                return ExecutionResult::Failed;
+            }
+        }
         else
             ForcesModule::totalForces(moduleContext.processPool(), targetConfiguration_, targetMolecules,
                                       moduleContext.dissolve().potentialMap(),
                                       intramolecularForcesOnly_ ? ForcesModule::ForceCalculationType::IntraMolecularFull
                                                                 : ForcesModule::ForceCalculationType::Full,
-                                      fUnbound, fBound, commsTimer);
-        std::transform(fUnbound.begin(), fUnbound.end(), fUnbound.begin(), [](auto f) { return f * 100.0; });
-        std::transform(fBound.begin(), fBound.end(), fBound.begin(), [](auto f) { return f * 100.0; });
-
-        // Cap forces
-        if (capForces_)
-            nCapped = capForces(maxForce, fUnbound, fBound);
-
-        // Velocity Verlet second stage (B) and velocity scaling
-        // A:  r(t+dt) = r(t) + v(t)*dt + 0.5*a(t)*dt**2
-        // A:  v(t+dt/2) = v(t) + 0.5*a(t)*dt
-        // B:  a(t+dt) = F(t+dt)/m
-        // B:  v(t+dt) = v(t+dt/2) + 0.5*a(t+dt)*dt
-        ke = 0.0;
-        for (auto &&[f1, f2, v, a, m] : zip(fUnbound, fBound, velocities, accelerations, mass))
+                                      fUnbound, fBound, commsTimer, neighbourList());
+
+        // Velocity Verlet second stage (B), converting forces to internal units, capping them, and summing kinetic energy
+        // in the same pass
+        dissolve::CombinableValue<double> combinableKE(0.0);
+        dissolve::CombinableValue<int> combinableNCapped(0);
+        forEachAtom(
+            [&](const auto n)
+            {
+                // Must multiply by 100.0 to convert from kJ/mol to 10J/mol (our internal MD units)
+                auto &f1 = fUnbound[n], &f2 = fBound[n];
+                f1 *= 100.0;
+                f2 *= 100.0;
+                if (capForces_ && capForces(maxForce, f1, f2))
+                    ++combinableNCapped.local();
+
+                // Determine new accelerations
+                auto &v = velocities[n];
+                auto m = mass[n];
+                accelerations[n] = (f1 + f2) / m;
+
+                // ..and finally velocities again (by second half-step, with bound forces over the inner step for RESPA)
+                if (useRESPA)
+                    v += (f1 * dT + f2 * dTInner) * 0.5 / m;
+                else
+                    v += accelerations[n] * 0.5 * dT;
+
+                combinableKE.local() += 0.5 * m * v.dp(v);
+            });
+        ke = combinableKE.finalize();
+        nCapped += combinableNCapped.finalize();
+        if (ownership)
         {
-            // Determine new accelerations
-            a = (f1 + f2) / m;
-
-            // ..and finally velocities again (by second half-step)
-            v += a * 0.5 * dT;
-
-            ke += 0.5 * m * v.dp(v);
+            // Sum kinetic energy, checking at the same time that no atoms moved too far to be handed over
+            double values[2] = {ke, double(nLostAtoms)};
+            moduleContext.processPool().allSum(values, 2, ProcessPool::PoolProcessesCommunicator, commsTimer);
+            ke = values[0];
+            if (values[1] > 0.0)
+            {
+                Messenger::error("Atoms moved more than one cell in a single step, so their ownership could not be "
+                                 "transferred. Stopping evolution.\n");
+                return ExecutionResult::Failed;
+            }
         }
 
-        // Rescale velocities for desired temperature
+        // Determine velocity scaling for desired temperature
         tInstant = ke * 2.0 / (3.0 * targetConfiguration_->nAtoms() * kb);
-        tScale = sqrt(temperature / tInstant);
-        std::transform(velocities.begin(), velocities.end(), velocities.begin(), [tScale](auto &v) { return v * tScale; });
+        vScale = thermostatScaling(thermostat_, dT, thermostatTimeConstant_, temperature, tInstant, xi);
 
         // Convert ke from 10J/mol to kJ/mol
         ke *= 0.01;
 
+        // Energies and trajectory frames require current positions for all atoms
+        auto summaryStep = outputFrequency_ && (step == 1 || (step % outputFrequency_.value() == 0));
+        auto trajectoryStep = trajectoryFrequency_ && (step % trajectoryFrequency_.value() == 0);
+        if (ownership && ((summaryStep && energyStep) || trajectoryStep) && !synchroniseAtoms(false))
+            return ExecutionResult::Failed;
+
         // Write step summary?
-        if (outputFrequency_ && (step == 1 || (step % outputFrequency_.value() == 0)))
+        if (summaryStep)
         {
             // Include total energy term?
-            if (energyFrequency_ && (step % energyFrequency_.value() == 0))
+            if (energyStep)
             {
-                pePP = EnergyModule::pairPotentialEnergy(moduleContext.processPool(), targetConfiguration_,
-                                                         moduleContext.dissolve().potentialMap());
+                pePP = fusedEnergy ? energyAndVirial.energy
+                                   : EnergyModule::pairPotentialEnergy(moduleContext.processPool(), targetConfiguration_,
+                                                                       moduleContext.dissolve().potentialMap());
                 peBound = EnergyModule::intraMolecularEnergy(moduleContext.processPool(), targetConfiguration_,
                                                              moduleContext.dissolve().potentialMap());
                 Messenger::print("  {:<10d}    {:10.3e}   {:10.3e}   {:10.3e}   {:10.3e}   {:10.3e}   {:10.3e}\n", step,
@@ -335,9 +649,19 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
         }
 
         // Save trajectory frame
-        if (trajectoryFrequency_ && (step % trajectoryFrequency_.value() == 0))
+        if (trajectoryStep)
         {
-            if (moduleContext.processPool().isMaster())
+            if (moduleContext.processPool().isMaster() && !textTrajectory)
+            {
+                if (!trajectoryExporter.exportData(targetConfiguration_))
+                {
+                    moduleContext.processPool().decideFalse();
+                    return ExecutionResult::Failed;
+                }
+
+                moduleContext.processPool().decideTrue();
+            }
+            else if (moduleContext.processPool().isMaster())
             {
                 // Write number of atoms
                 trajParser.writeLineF("{}\n", targetConfiguration_->nAtoms());
@@ -374,10 +698,24 @@ Module::ExecutionResult MDModule::process(ModuleContext &moduleContext)
     }
     timer.stop();
 
+    // Share the final positions and velocities of owned atoms, and the number of forces capped
+    if (ownership)
+    {
+        if (!synchroniseAtoms(true))
+            return ExecutionResult::Failed;
+        moduleContext.processPool().allSum(&nCapped, 1);
+    }
+
+    // Apply any outstanding velocity scaling from the thermostat
+    if (vScale != 1.0)
+        std::transform(velocities.begin(), velocities.end(), velocities.begin(), [vScale](auto v) { return v * vScale; });
+
     // Close trajectory file
     if (trajectoryFrequency_.value_or(0) > 0 && moduleContext.processPool().isMaster())
         trajParser.closeFiles();
 
+    if (useNeighbourList)
+        Messenger::print("Neighbour list was built {} time(s) over the course of the dynamics.\n", nNeighbourListBuilds);
     if (capForces_)
         Messenger::print("A total of {} forces were capped over the course of the dynamics ({:9.3e} per step).\n", nCapped,
                          double(nCapped) / nSteps_);
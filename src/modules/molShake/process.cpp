@@ -1,16 +1,18 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
-#include "base/randomBuffer.h"
+#include "base/randomStream.h"
 #include "base/timer.h"
 #include "classes/box.h"
 #include "classes/changeStore.h"
+#include "classes/domainDecomposition.h"
 #include "classes/regionalDistributor.h"
 #include "classes/species.h"
 #include "kernels/producer.h"
 #include "main/dissolve.h"
 #include "module/context.h"
 #include "modules/molShake/molShake.h"
+#include "templates/algorithms.h"
 
 // Run main processing
 Module::ExecutionResult MolShakeModule::process(ModuleContext &moduleContext)
@@ -58,25 +60,143 @@ Module::ExecutionResult MolShakeModule::process(ModuleContext &moduleContext)
     auto kernel = KernelProducer::energyKernel(targetConfiguration_, moduleContext.processPool(),
                                                moduleContext.dissolve().potentialMap(), rCut);
 
-    // Initialise the random number buffer
-    RandomBuffer randomBuffer(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
+    // Initialise the random number stream
+    RandomStream randomStream(moduleContext.processPool(), ProcessPool::subDivisionStrategy(strategy), commsTimer);
 
-    int shake, nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
-               nGeneralAttempts = 0;
-    bool accept;
-    double currentEnergy, newEnergy, delta, totalDelta = 0.0;
-    Matrix3 transform;
-    Vec3<double> rDelta;
+    // Statistics for a set of moves
+    struct ShakeStatistics
+    {
+        int nRotationAttempts{0}, nTranslationAttempts{0}, nRotationsAccepted{0}, nTranslationsAccepted{0},
+            nGeneralAttempts{0};
+        double totalDelta{0.0};
+    };
+    auto nRotationAttempts = 0, nTranslationAttempts = 0, nRotationsAccepted = 0, nTranslationsAccepted = 0,
+         nGeneralAttempts = 0;
+    auto totalDelta = 0.0;
     const auto *box = targetConfiguration_->box();
+    const auto &cells = targetConfiguration_->cells();
 
     /*
      * In order to be able to adjust translation and rotational steps independently, we will perform 80% of moves
      * including both a translation a rotation, 10% using only translations, and 10% using only rotations.
      */
 
+    // Shake the specified Molecule, drawing random numbers from the supplied stream and using the supplied counter
+    // to determine whether to perform R+T, R, or T
+    // If a domain is specified, any move which would take an atom outside of it, or into a cell with insufficient free storage
+    // slots, is rejected without evaluating its energy
+    auto shakeMolecule = [&](int molId, ChangeStore &store, RandomStream &stream, int &count,
+                             const DomainDecomposition &domains, int domain, ShakeStatistics &stats)
+    {
+        Matrix3 transform;
+        Vec3<double> rDelta;
+        bool rotate, translate;
+
+        // Get Molecule index and pointer
+        auto mol = targetConfiguration_->molecule(molId);
+
+        // Set current atom targets in ChangeStore (whole Molecule)
+        store.add(mol);
+
+        // Calculate reference pair potential energy for Molecule, excluding all intramolecular contributions
+        auto currentEnergy =
+            kernel->totalEnergy(*mol, {EnergyKernel::ExcludeGeometry, EnergyKernel::ExcludeIntraMolecularPairPotential})
+                .total();
+
+        // Loop over number of shakes per atom
+        for (auto shake = 0; shake < nShakesPerMolecule_; ++shake)
+        {
+            // Determine what move(s) will we attempt
+            if (count == 0)
+            {
+                rotate = true;
+                translate = false;
+            }
+            else if (count == 1)
+            {
+                rotate = false;
+                translate = true;
+            }
+            else
+            {
+                rotate = true;
+                translate = true;
+            }
+
+            // Increase and fold move type counter
+            ++count;
+            if (count > 9)
+                count = 0;
+
+            // Increase attempt counters
+            ++stats.nGeneralAttempts;
+            if (rotate)
+                ++stats.nRotationAttempts;
+            if (translate)
+                ++stats.nTranslationAttempts;
+
+            // Create a random translation vector and apply it to the Molecule's centre
+            if (translate)
+            {
+                rDelta.set(stream.randomPlusMinusOne() * translationStepSize_,
+                           stream.randomPlusMinusOne() * translationStepSize_,
+                           stream.randomPlusMinusOne() * translationStepSize_);
+                mol->translate(rDelta);
+            }
+
+            // Create a random rotation matrix and apply it to the Molecule
+            if (rotate)
+            {
+                transform.createRotationXY(stream.randomPlusMinusOne() * rotationStepSize_,
+                                           stream.randomPlusMinusOne() * rotationStepSize_);
+                mol->transform(box, transform);
+            }
+
+            // Reject the move outright if any atom has left the domain, or cell storage would need to be laid out afresh
+            // (which must not happen while other domains are being modified)
+            if (domain != -1 &&
+                (std::any_of(mol->atoms().begin(), mol->atoms().end(),
+                             [&](const auto *i) { return domains.domain(cells.cell(box->fold(i->r()))) != domain; }) ||
+                 !cells.canMoveInPlace(mol->atoms())))
+            {
+                store.revertAll();
+                continue;
+            }
+
+            // Update Cell positions of Atoms in the Molecule
+            targetConfiguration_->updateAtomLocations(mol);
+
+            // Calculate new energy
+            auto newEnergy =
+                kernel->totalEnergy(*mol, {EnergyKernel::ExcludeGeometry, EnergyKernel::ExcludeIntraMolecularPairPotential})
+                    .total();
+
+            // Trial the transformed atom position
+            auto delta = newEnergy - currentEnergy;
+            auto accept = delta < 0 ? true : (stream.random() < exp(-delta * rRT));
+
+            if (accept)
+            {
+                // Accept new (current) position of target Atoms
+                store.updateAll();
+                currentEnergy = newEnergy;
+
+                stats.totalDelta += delta;
+                if (rotate)
+                    ++stats.nRotationsAccepted;
+                if (translate)
+                    ++stats.nTranslationsAccepted;
+            }
+            else
+                store.revertAll();
+        }
+
+        // Store modifications to Atom positions ready for broadcast
+        store.storeAndReset();
+    };
+
     // Set initial random offset for our counter determining whether to perform R+T, R, or T.
-    auto count = randomBuffer.random() * 10;
-    bool rotate, translate;
+    int count = randomStream.random() * 10;
 
     Timer timer;
     while (distributor.cycle())
@@ -90,122 +210,73 @@ Module::ExecutionResult MolShakeModule::process(ModuleContext &moduleContext)
             // Set the new strategy
             strategy = distributor.currentStrategy();
 
-            // Re-initialise the random buffer
-            randomBuffer.reset(ProcessPool::subDivisionStrategy(strategy));
+            // Re-initialise the random stream
+            randomStream.reset(ProcessPool::subDivisionStrategy(strategy));
         }
 
-        // Loop over target Molecules
-        for (auto molId : targetIndices)
+        // Partition target Molecules into slabs of cells which can be shaken concurrently, rotating the slab boundaries at
+        // random on each cycle - any which span slabs are shaken serially afterwards
+        std::vector<ShakeStatistics> cycleStatistics;
+        DomainDecomposition domains(cells, static_cast<int>(randomStream.random() * cells.divisions().x));
+        auto serialIndices = domains.partition(targetConfiguration_, targetIndices);
+        if (domains.nDomains() > 0)
         {
-            /*
-             * Calculation Begins
-             */
-
-            // Get Molecule index and pointer
-            auto mol = targetConfiguration_->molecule(molId);
+            // Make sure every cell has enough free slots to take any one of the molecules, so that few moves between cells are
+            // rejected for lack of them
+            auto nFree = 1;
+            for (auto n = 0; n < domains.nDomains(); ++n)
+                for (auto molId : domains.molecules(n))
+                    nFree = std::max(nFree, targetConfiguration_->molecule(molId)->nAtoms());
+            targetConfiguration_->cells().reserveFreeSlots(nFree);
+        }
 
-            // Set current atom targets in ChangeStore (whole Molecule)
-            changeStore.add(mol);
+        // Storage must stay in place while domains are shaken concurrently
+        targetConfiguration_->cells().setStorageFixed(true);
+        for (auto colour : {0, 1})
+        {
+            auto colourDomains = domains.concurrentDomains(colour);
+
+            // Create an independent random stream for each domain
+            std::vector<RandomStream> domainStreams;
+            for (auto n = 0; n < colourDomains.size(); ++n)
+                domainStreams.emplace_back(randomStream.createTaskStream());
+            std::vector<ChangeStore> domainChangeStores(colourDomains.size(), ChangeStore(moduleContext.processPool()));
+            std::vector<ShakeStatistics> domainStatistics(colourDomains.size());
+            dissolve::for_each(ParallelPolicies::par, dissolve::counting_iterator<int>(0),
+                               dissolve::counting_iterator<int>(colourDomains.size()),
+                               [&](const auto n)
+                               {
+                                   int domainCount = domainStreams[n].random() * 10;
+                                   for (auto molId : domains.molecules(colourDomains[n]))
+                                       shakeMolecule(molId, domainChangeStores[n], domainStreams[n], domainCount, domains,
+                                                     colourDomains[n], domainStatistics[n]);
+                               });
+
+            // Gather changes and statistics from each domain
+            for (auto n = 0; n < colourDomains.size(); ++n)
+                changeStore.takeChanges(domainChangeStores[n]);
+            cycleStatistics.insert(cycleStatistics.end(), domainStatistics.begin(), domainStatistics.end());
+        }
+        targetConfiguration_->cells().setStorageFixed(false);
 
-            // Calculate reference pair potential energy for Molecule, excluding all intramolecular contributions
-            currentEnergy =
-                kernel->totalEnergy(*mol, {EnergyKernel::ExcludeGeometry, EnergyKernel::ExcludeIntraMolecularPairPotential})
-                    .total();
+        // Loop over remaining target Molecules
+        auto &serialStatistics = cycleStatistics.emplace_back();
+        for (auto molId : serialIndices)
+            shakeMolecule(molId, changeStore, randomStream, count, domains, -1, serialStatistics);
 
-            // Loop over number of shakes per atom
-            for (shake = 0; shake < nShakesPerMolecule_; ++shake)
+        // Increase attempt counters
+        // The strategy in force at any one time may vary, so use the distributor's helper functions.
+        if (distributor.collectStatistics())
+            for (const auto &stats : cycleStatistics)
             {
-                // Determine what move(s) will we attempt
-                if (count == 0)
-                {
-                    rotate = true;
-                    translate = false;
-                }
-                else if (count == 1)
-                {
-                    rotate = false;
-                    translate = true;
-                }
-                else
-                {
-                    rotate = true;
-                    translate = true;
-                }
-
-                // Create a random translation vector and apply it to the Molecule's centre
-                if (translate)
-                {
-                    rDelta.set(randomBuffer.randomPlusMinusOne() * translationStepSize_,
-                               randomBuffer.randomPlusMinusOne() * translationStepSize_,
-                               randomBuffer.randomPlusMinusOne() * translationStepSize_);
-                    mol->translate(rDelta);
-                }
-
-                // Create a random rotation matrix and apply it to the Molecule
-                if (rotate)
-                {
-                    transform.createRotationXY(randomBuffer.randomPlusMinusOne() * rotationStepSize_,
-                                               randomBuffer.randomPlusMinusOne() * rotationStepSize_);
-                    mol->transform(box, transform);
-                }
-
-                // Update Cell positions of Atoms in the Molecule
-                targetConfiguration_->updateAtomLocations(mol);
-
-                // Calculate new energy
-                newEnergy =
-                    kernel->totalEnergy(*mol, {EnergyKernel::ExcludeGeometry, EnergyKernel::ExcludeIntraMolecularPairPotential})
-                        .total();
-
-                // Trial the transformed atom position
-                delta = newEnergy - currentEnergy;
-                accept = delta < 0 ? true : (randomBuffer.random() < exp(-delta * rRT));
-
-                if (accept)
-                {
-                    // Accept new (current) position of target Atoms
-                    changeStore.updateAll();
-                    currentEnergy = newEnergy;
-                }
-                else
-                    changeStore.revertAll();
-
-                // Increase attempt counters
-                // The strategy in force at any one time may vary, so use the distributor's helper
-                // functions.
-                if (distributor.collectStatistics())
-                {
-                    if (accept)
-                        totalDelta += delta;
-                    if (rotate)
-                    {
-                        if (accept)
-                            ++nRotationsAccepted;
-                        ++nRotationAttempts;
-                    }
-                    if (translate)
-                    {
-                        if (accept)
-                            ++nTranslationsAccepted;
-                        ++nTranslationAttempts;
-                    }
-                    ++nGeneralAttempts;
-                }
-
-                // Increase and fold move type counter
-                ++count;
-                if (count > 9)
-                    count = 0;
+                nGeneralAttempts += stats.nGeneralAttempts;
+                nRotationAttempts += stats.nRotationAttempts;
+                nRotationsAccepted += stats.nRotationsAccepted;
+                nTranslationAttempts += stats.nTranslationAttempts;
+                nTranslationsAccepted += stats.nTranslationsAccepted;
+                totalDelta += stats.totalDelta;
             }
 
-            // Store modifications to Atom positions ready for broadcast
-            changeStore.storeAndReset();
-
-            /*
-             * Calculation End
-             */
-        }
-
         // Now all target Molecules have been processes, broadcast the changes made
         changeStore.distributeAndApply(targetConfiguration_);
         changeStore.reset();
@@ -19,111 +19,158 @@ Module::ExecutionResult SiteRDFModule::process(ModuleContext &moduleContext)
 {
     auto &processingData = moduleContext.dissolve().processingModuleData();
 
-    // Select site A
-    SiteSelector a(targetConfiguration_, a_);
-
-    // Select site B
-    SiteSelector b(targetConfiguration_, b_);
-
-    // Calculate rAB
+    // Realise histogram
     auto [histAB, status] = processingData.realiseIf<Histogram1D>("Histo-AB", name(), GenericItem::InRestartFileFlag);
     if (status == GenericItem::ItemStatus::Created)
         histAB.initialise(distanceRange_.x, distanceRange_.y, distanceRange_.z);
-    histAB.zeroBins();
-
-    auto combinableHistograms = dissolve::CombinableValue<Histogram1D>(histAB);
-
-    dissolve::for_each(std::execution::par, a.sites().begin(), a.sites().end(),
-                       [this, &b, &combinableHistograms](const auto &pair)
-                       {
-                           const auto &[siteA, indexA] = pair;
 
-                           auto &hist = combinableHistograms.local();
-                           for (const auto &[siteB, indexB] : b.sites())
+    // Bin rAB for each frame - either the current contents of the configuration, or the batch of frame snapshots stored
+    // for it by a preceding module, the latter being binned concurrently
+    const auto &snapshots = targetConfiguration_->snapshots();
+    const auto nFrames = std::max(int(snapshots.size()), 1);
+    std::vector<Histogram1D> frameHistograms(nFrames);
+    std::vector<std::pair<int, int>> framePopulations(nFrames);
+    if (snapshots.empty())
+    {
+        // Select sites A and B
+        SiteSelector a(targetConfiguration_, a_);
+        SiteSelector b(targetConfiguration_, b_);
+
+        histAB.zeroBins();
+        auto combinableHistograms = dissolve::CombinableValue<Histogram1D>(histAB);
+
+        dissolve::for_each(ParallelPolicies::par, a.sites().begin(), a.sites().end(),
+                           [this, &b, &combinableHistograms](const auto &pair)
                            {
-                               if (excludeSameMolecule_ && (siteB->molecule() == siteA->molecule()))
-                                   continue;
-                               hist.bin(targetConfiguration_->box()->minimumDistance(siteA->origin(), siteB->origin()));
-                           }
-                       });
+                               const auto &[siteA, indexA] = pair;
+
+                               auto &hist = combinableHistograms.local();
+                               for (const auto &[siteB, indexB] : b.sites())
+                               {
+                                   if (excludeSameMolecule_ && (siteB->molecule() == siteA->molecule()))
+                                       continue;
+                                   hist.bin(targetConfiguration_->box()->minimumDistance(siteA->origin(), siteB->origin()));
+                               }
+                           });
+
+        frameHistograms.front() = combinableHistograms.finalize();
+        framePopulations.front() = {int(a.sites().size()), int(b.sites().size())};
+    }
+    else
+        dissolve::for_each(
+            ParallelPolicies::par, dissolve::counting_iterator<int>(0), dissolve::counting_iterator<int>(nFrames),
+            [this, &snapshots, &histAB, &frameHistograms, &framePopulations](const auto frame)
+            {
+                const auto &snapshot = snapshots[frame];
 
-    histAB = combinableHistograms.finalize();
+                // Select sites A and B
+                SiteSelector a(snapshot, a_);
+                SiteSelector b(snapshot, b_);
 
-    // Accumulate histogram
-    histAB.accumulate();
+                auto &hist = frameHistograms[frame];
+                hist.initialise(histAB.minimum(), histAB.maximum(), histAB.binWidth());
+                for (const auto &[siteA, indexA] : a.sites())
+                    for (const auto &[siteB, indexB] : b.sites())
+                    {
+                        if (excludeSameMolecule_ && (siteB->molecule() == siteA->molecule()))
+                            continue;
+                        hist.bin(snapshot.box()->minimumDistance(siteA->origin(), siteB->origin()));
+                    }
 
-    // RDF
-    auto &dataRDF = processingData.realise<Data1D>("RDF", name(), GenericItem::InRestartFileFlag);
-    dataRDF = histAB.accumulatedData();
+                framePopulations[frame] = {int(a.sites().size()), int(b.sites().size())};
+            });
 
-    // Normalise
-    DataOperator1D normaliserRDF(dataRDF);
-    // Normalise by A site population
-    normaliserRDF.divide(double(a.sites().size()));
+    auto &dataRDF = processingData.realise<Data1D>("RDF", name(), GenericItem::InRestartFileFlag);
+    auto &dataCN = processingData.realise<Data1D>("HistogramNorm", name(), GenericItem::InRestartFileFlag);
+    auto &dataRunningCN = processingData.realise<SampledData1D>("RunningCNTest", name(), GenericItem::InRestartFileFlag);
+    const std::vector<std::string> rangeNames = {"A", "B", "C"};
 
-    // Normalise by B site population density
-    normaliserRDF.divide(double(b.sites().size()) / targetConfiguration_->box()->volume());
+    // Accumulate frames in order
+    for (auto frame = 0; frame < nFrames; ++frame)
+    {
+        const auto [nA, nB] = framePopulations[frame];
 
-    // Normalise by spherical shell
-    normaliserRDF.normaliseBySphericalShell();
+        // Accumulate histogram
+        histAB.zeroBins();
+        histAB.add(frameHistograms[frame]);
+        histAB.accumulate();
 
-    // CN
-    auto &dataCN = processingData.realise<Data1D>("HistogramNorm", name(), GenericItem::InRestartFileFlag);
-    dataCN = histAB.accumulatedData();
+        // CN
+        dataCN = histAB.accumulatedData();
 
-    // Normalise
-    DataOperator1D normaliserCN(dataCN);
-    // Normalise by A site population
-    normaliserCN.divide(double(a.sites().size()));
+        // Normalise
+        DataOperator1D normaliserCN(dataCN);
+        // Normalise by A site population
+        normaliserCN.divide(double(nA));
 
-    const std::vector<std::string> rangeNames = {"A", "B", "C"};
-    for (int i = 0; i < 3; ++i)
-        if (rangeEnabled_[i])
-        {
-            auto &sumN = processingData.realise<SampledDouble>(fmt::format("CN//{}", rangeNames[i]), name(),
-                                                               GenericItem::InRestartFileFlag);
-            sumN += Integrator::sum(dataCN, range_[i]);
-            if (instantaneous_)
+        for (int i = 0; i < 3; ++i)
+            if (rangeEnabled_[i])
             {
-                auto &sumNInst = processingData.realise<Data1D>(fmt::format("CN//{}Inst", rangeNames[i]), name(),
-                                                                GenericItem::InRestartFileFlag);
-                sumNInst.addPoint(moduleContext.dissolve().iteration(), sumN.value());
-                if (exportInstantaneous_)
+                auto &sumN = processingData.realise<SampledDouble>(fmt::format("CN//{}", rangeNames[i]), name(),
+                                                                   GenericItem::InRestartFileFlag);
+                sumN += Integrator::sum(dataCN, range_[i]);
+                if (instantaneous_)
                 {
-                    Data1DExportFileFormat exportFormat(fmt::format("{}_Sum{}.txt", name(), rangeNames[i]));
-                    if (!DataExporter<Data1D, Data1DExportFileFormat>::exportData(sumNInst, exportFormat,
-                                                                                  moduleContext.processPool()))
-                    {
-                        Messenger::error("Failed to write instantaneous coordination number data for range {}.\n",
-                                         rangeNames[i]);
-                        return ExecutionResult::Failed;
-                    }
+                    auto &sumNInst = processingData.realise<Data1D>(fmt::format("CN//{}Inst", rangeNames[i]), name(),
+                                                                    GenericItem::InRestartFileFlag);
+                    // Frames in a batch are spread evenly over the iteration, the last falling on the iteration itself
+                    sumNInst.addPoint(moduleContext.dissolve().iteration() - 1.0 + double(frame + 1) / nFrames, sumN.value());
                 }
             }
-        }
 
-    auto &dataRunningCN = processingData.realise<SampledData1D>("RunningCNTest", name(), GenericItem::InRestartFileFlag);
-    std::vector<double> runningCN;
+        // Accumulate instantaneous binValues
+        auto instBinValues = histAB.data();
+
+        // Normalise Data
+        DataOperator1D normaliserInstBinValues(instBinValues);
+
+        // Normalise by A site population
+        normaliserInstBinValues.divide(double(nA));
+
+        auto sum = 0.0;
+        std::transform(instBinValues.values().begin(), instBinValues.values().end(), instBinValues.values().begin(),
+                       [&](const auto &currentBin)
+                       {
+                           sum += currentBin;
+                           return sum;
+                       });
 
-    // Accumulate instantaneous binValues
-    auto instBinValues = histAB.data();
+        // Add normalised data
+        dataRunningCN += instBinValues;
 
-    // Normalise Data
-    DataOperator1D normaliserInstBinValues(instBinValues);
+        // RDF
+        if (frame == nFrames - 1)
+        {
+            dataRDF = histAB.accumulatedData();
+
+            // Normalise
+            DataOperator1D normaliserRDF(dataRDF);
+            // Normalise by A site population
+            normaliserRDF.divide(double(nA));
 
-    // Normalise by A site population
-    normaliserInstBinValues.divide(double(a.sites().size()));
+            // Normalise by B site population density
+            normaliserRDF.divide(double(nB) / targetConfiguration_->box()->volume());
 
-    auto sum = 0.0;
-    std::transform(instBinValues.values().begin(), instBinValues.values().end(), instBinValues.values().begin(),
-                   [&](const auto &currentBin)
-                   {
-                       sum += currentBin;
-                       return sum;
-                   });
+            // Normalise by spherical shell
+            normaliserRDF.normaliseBySphericalShell();
+        }
+    }
 
-    // Add normalised data
-    dataRunningCN += instBinValues;
+    // Export instantaneous coordination numbers
+    if (instantaneous_ && exportInstantaneous_)
+        for (int i = 0; i < 3; ++i)
+            if (rangeEnabled_[i])
+            {
+                auto &sumNInst = processingData.realise<Data1D>(fmt::format("CN//{}Inst", rangeNames[i]), name(),
+                                                                GenericItem::InRestartFileFlag);
+                Data1DExportFileFormat exportFormat(fmt::format("{}_Sum{}.txt", name(), rangeNames[i]));
+                if (!DataExporter<Data1D, Data1DExportFileFormat>::exportData(sumNInst, exportFormat,
+                                                                              moduleContext.processPool()))
+                {
+                    Messenger::error("Failed to write instantaneous coordination number data for range {}.\n", rangeNames[i]);
+                    return ExecutionResult::Failed;
+                }
+            }
 
     // Create the display data
     processingData.realise<SampledData1D>("RunningCN", name(), GenericItem::InRestartFileFlag) = dataRunningCN;
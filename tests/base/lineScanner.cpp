@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/lineScanner.h"
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace UnitTest
+{
+// Read all fields from the supplied text as doubles, requiring that they are all valid
+std::vector<double> readDoubles(const std::string &text)
+{
+    LineScanner scanner(text.data(), text.data() + text.size());
+    std::vector<double> values;
+    double value;
+    while (!scanner.onlyWhitespaceRemains())
+    {
+        EXPECT_TRUE(scanner.readDouble(value));
+        values.push_back(value);
+        scanner.skipWhitespace();
+    }
+    return values;
+}
+
+TEST(LineScannerTest, ReadDouble)
+{
+    // Plain and signed values, with trailing delimiters of all kinds
+    EXPECT_EQ(readDoubles("1 -2 +3 4.5\t-0.25,6.\r\n.5"), std::vector<double>({1.0, -2.0, 3.0, 4.5, -0.25, 6.0, 0.5}));
+
+    // Values which can be converted exactly must match the standard library
+    for (auto field : {"0.1", "1.234567", "-98765.4321", "3.14159265358979", "0.000123", "123456789012345", "2.5e-3"})
+        EXPECT_EQ(readDoubles(field).front(), std::strtod(field, nullptr)) << field;
+}
+
+TEST(LineScannerTest, ReadDoubleExponents)
+{
+    EXPECT_EQ(readDoubles("1e3 1E3 1e+3 1.5e-2 -2.5E-1"), std::vector<double>({1.0e3, 1.0e3, 1.0e3, 1.5e-2, -2.5e-1}));
+
+    // Fortran-style exponents
+    EXPECT_EQ(readDoubles("1d3 1D3 1.5D-2 -2.5d+1"), std::vector<double>({1.0e3, 1.0e3, 1.5e-2, -25.0}));
+
+    // Exponents beyond those exactly representable fall back to the standard library, which must see Fortran-style ones
+    // converted
+    EXPECT_EQ(readDoubles("1.0e-30 1.0e30 4.2D-100 -4.2D+100"), std::vector<double>({1.0e-30, 1.0e30, 4.2e-100, -4.2e100}));
+}
+
+TEST(LineScannerTest, ReadDoubleLongMantissas)
+{
+    // Mantissas with more significant digits than can be represented exactly fall back to the standard library
+    for (auto field : {"0.12345678901234567890123", "1234567890.1234567890", "-9007199254740993", "123456789012345678901234",
+                       "0.00000000000000000000000000001234567890123456789", "1.2345678901234567890D+05"})
+    {
+        std::string text(field);
+        auto expected = text;
+        std::replace(expected.begin(), expected.end(), 'D', 'e');
+        EXPECT_EQ(readDoubles(text).front(), std::strtod(expected.c_str(), nullptr)) << field;
+    }
+
+    // Leading zeros are not significant
+    EXPECT_EQ(readDoubles("00000000000000000000000001.5").front(), 1.5);
+}
+
+TEST(LineScannerTest, ReadDoubleInvalid)
+{
+    for (auto field : {"", "abc", "-", ".", "1.0x", "1e", "1e+", "1.0.0", "--1"})
+    {
+        std::string text(field);
+        LineScanner scanner(text.data(), text.data() + text.size());
+        double value;
+        EXPECT_FALSE(scanner.readDouble(value)) << field;
+    }
+}
+
+TEST(LineScannerTest, Lines)
+{
+    std::string text = "H 1.0 2.0 3.0\nO 4.0 5.0 6.0\n\n  last";
+    LineScanner scanner(text.data(), text.data() + text.size());
+
+    // Read fields from the first line, skipping the element
+    double x, y, z;
+    EXPECT_TRUE(scanner.skipField());
+    EXPECT_TRUE(scanner.readDouble(x) && scanner.readDouble(y) && scanner.readDouble(z));
+    EXPECT_EQ(x, 1.0);
+    EXPECT_EQ(z, 3.0);
+
+    // No more fields on the line
+    EXPECT_FALSE(scanner.readDouble(x));
+    EXPECT_FALSE(scanner.skipField());
+
+    // Skip the second line, and find the final one
+    EXPECT_TRUE(scanner.nextLine());
+    EXPECT_TRUE(scanner.skipLines(1));
+    EXPECT_FALSE(scanner.onlyWhitespaceRemains());
+    scanner.skipWhitespace();
+    EXPECT_TRUE(scanner.skipField());
+    EXPECT_TRUE(scanner.atEnd());
+    EXPECT_FALSE(scanner.skipLines(1));
+}
+} // namespace UnitTest
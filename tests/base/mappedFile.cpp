@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/mappedFile.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace UnitTest
+{
+// Write specified contents to the named file
+void writeFile(const std::string &filename, const std::string &contents)
+{
+    std::ofstream file(filename, std::ios::binary);
+    file << contents;
+}
+
+TEST(MappedFileTest, Basic)
+{
+    const std::string filename = "TestOutput_mappedFile.basic.txt";
+    const std::string contents = "Memory-mapped\nfile contents\n";
+    writeFile(filename, contents);
+
+    MappedFile file;
+    EXPECT_FALSE(file.isOpen());
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.filename(), filename);
+    ASSERT_EQ(file.size(), contents.size());
+    EXPECT_EQ(std::string(file.data(), file.size()), contents);
+
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_TRUE(file.filename().empty());
+
+    std::filesystem::remove(filename);
+}
+
+TEST(MappedFileTest, Empty)
+{
+    const std::string filename = "TestOutput_mappedFile.empty.txt";
+    writeFile(filename, "");
+
+    // Empty files are valid but have no data
+    MappedFile file;
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), 0);
+
+    file.close();
+    std::filesystem::remove(filename);
+}
+
+TEST(MappedFileTest, Missing)
+{
+    MappedFile file;
+    EXPECT_FALSE(file.open("TestOutput_mappedFile.missing.txt"));
+    EXPECT_FALSE(file.isOpen());
+}
+
+TEST(MappedFileTest, Remap)
+{
+    const std::string filename = "TestOutput_mappedFile.remap.txt";
+    writeFile(filename, "first");
+
+    MappedFile file;
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_EQ(std::string(file.data(), file.size()), "first");
+
+    // Grow the file and map it again, which should pick up the new contents
+    {
+        std::ofstream stream(filename, std::ios::binary | std::ios::app);
+        stream << " and second";
+    }
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_EQ(std::string(file.data(), file.size()), "first and second");
+
+    file.close();
+    std::filesystem::remove(filename);
+}
+} // namespace UnitTest
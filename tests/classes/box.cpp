@@ -2,6 +2,7 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "classes/box.h"
+#include "classes/minimumImage.h"
 #include <gtest/gtest.h>
 
 namespace UnitTest
@@ -84,6 +85,20 @@ void testBox(Box &box)
         EXPECT_NEAR(mimCorner.y, mim.y, 1.0e-8);
         EXPECT_NEAR(mimCorner.z, mim.z, 1.0e-8);
 
+        // Minimum image functor
+        MinimumImage::dispatch(box,
+                               [&](const auto mimFunctor)
+                               {
+                                   auto offsetCorner = corner + box.axes() * Vec3<double>(0.13, -0.27, 0.41);
+                                   auto v = box.minimumVector(centroid, offsetCorner);
+                                   auto vFunctor = MinimumImage::vector(mimFunctor, centroid, offsetCorner);
+                                   EXPECT_NEAR(v.x, vFunctor.x, 1.0e-8);
+                                   EXPECT_NEAR(v.y, vFunctor.y, 1.0e-8);
+                                   EXPECT_NEAR(v.z, vFunctor.z, 1.0e-8);
+                                   EXPECT_NEAR(box.minimumDistanceSquared(centroid, offsetCorner),
+                                               MinimumImage::distanceSquared(mimFunctor, centroid, offsetCorner), 1.0e-8);
+                               });
+
         // Fold
         auto scaledCorner = box.axes() * Vec3<double>((n & 1) ? -2.0 : 0.0, (n & 2) ? 5.0 : 0.0, (n & 4) ? -97.0 : 0.0);
         scaledCorner += centroid;
@@ -2,6 +2,7 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "classes/atomType.h"
+#include "classes/domainDecomposition.h"
 #include "classes/species.h"
 #include "kernels/producer.h"
 #include "main/dissolve.h"
@@ -91,11 +92,171 @@ TEST(CellsTest, Basic)
         cfg->cells().generate(cfg->box(), cellSize, dissolve.pairPotentialRange());
         cfg->updateAtomLocations(true);
 
+        // Check cell-ordered coordinate block is consistent with cell contents
+        auto &coords = cfg->coordinateBlock();
+        ASSERT_EQ(coords.nAtoms(), cfg->nAtoms());
+        for (auto n = 0; n < cfg->cells().nCells(); ++n)
+        {
+            auto cellAtoms = cfg->cells().cell(n)->atoms();
+            ASSERT_EQ(coords.cellEnd(n) - coords.cellBegin(n), cellAtoms.size());
+            for (auto i = 0; i < cellAtoms.size(); ++i)
+            {
+                auto index = coords.cellBegin(n) + i;
+                EXPECT_EQ(coords.atoms()[index], cellAtoms[i]);
+                EXPECT_EQ(coords.globalIndices()[index], cellAtoms[i]->globalIndex());
+                EXPECT_NEAR((coords.r(index) - cellAtoms[i]->r()).magnitude(), 0.0, 1.0e-12);
+            }
+        }
+
         // Calculate total Cell-based energy
         EXPECT_NEAR(refEnergy, kernel->totalPairPotentialEnergy(false, ProcessPool::PoolStrategy).total(), 1.0e-4);
 
         // Calculate atomic energy from the Ar
         EXPECT_NEAR(refEnergy, kernel->totalEnergy(cfg->atom(0)).total(), 1.0e-4);
+
+        // Calculate total energy using a Verlet neighbour list
+        auto &neighbourList = cfg->neighbourList(rCut, 1.0);
+        auto listKernel = KernelProducer::energyKernel(cfg, dissolve.worldPool(), dissolve.potentialMap(), rCut, neighbourList);
+        EXPECT_NEAR(refEnergy, listKernel->totalPairPotentialEnergy(false, ProcessPool::PoolStrategy).total(), 1.0e-4);
+
+        // Forces calculated from the neighbour list should match those from cells
+        std::vector<Vec3<double>> fCells(cfg->nAtoms()), fList(cfg->nAtoms()), fBound(cfg->nAtoms());
+        KernelProducer::forceKernel(cfg, dissolve.worldPool(), dissolve.potentialMap(), rCut)
+            ->totalForces(fCells, fBound, ProcessPool::PoolStrategy);
+        KernelProducer::forceKernel(cfg, dissolve.worldPool(), dissolve.potentialMap(), rCut, neighbourList)
+            ->totalForces(fList, fBound, ProcessPool::PoolStrategy);
+        for (auto &&[f1, f2] : zip(fCells, fList))
+            EXPECT_NEAR((f1 - f2).magnitude(), 0.0, 1.0e-8);
+
+        // Pair potential energy accumulated alongside the forces should match that from the EnergyKernel
+        auto totalPPEnergy = kernel->totalPairPotentialEnergy(true, ProcessPool::PoolStrategy).total();
+        ForceKernel::EnergyAndVirial cellsEV, listEV;
+        KernelProducer::forceKernel(cfg, dissolve.worldPool(), dissolve.potentialMap(), rCut)
+            ->totalForces(fCells, fBound, ProcessPool::PoolStrategy, {}, cellsEV);
+        KernelProducer::forceKernel(cfg, dissolve.worldPool(), dissolve.potentialMap(), rCut, neighbourList)
+            ->totalForces(fList, fBound, ProcessPool::PoolStrategy, {}, listEV);
+        EXPECT_NEAR(refEnergy, cellsEV.energy.interMolecular(), 1.0e-4);
+        EXPECT_NEAR(totalPPEnergy, cellsEV.energy.total(), 1.0e-4);
+        EXPECT_NEAR(totalPPEnergy, listEV.energy.total(), 1.0e-4);
+        EXPECT_NEAR(cellsEV.virial, listEV.virial, 1.0e-6);
+    }
+}
+
+TEST(CellsTest, MoveAtoms)
+{
+    CoreData coreData;
+    auto *cfg = coreData.addConfiguration();
+    cfg->createBoxAndCells({20, 20, 20}, {90, 90, 90}, false, 9.0);
+    auto &cells = cfg->cells();
+    cells.generate(cfg->box(), 4.0, 9.0);
+    auto *firstCell = const_cast<Cell *>(cells.cell(0));
+    auto *lastCell = const_cast<Cell *>(cells.cell(cells.nCells() - 1));
+
+    // Assign atoms on a regular grid
+    std::vector<Atom> atoms(1000);
+    for (auto n = 0; n < atoms.size(); ++n)
+        atoms[n].setCoordinates(2.0 * (n % 10) + 0.5, 2.0 * ((n / 10) % 10) + 0.5, 2.0 * (n / 100) + 0.5);
+    cells.assignAtoms(atoms);
+
+    // Move atoms between the first and last cells (a periodic wrap), and then all atoms into the last cell, exhausting its
+    // free slots
+    for (auto n = 0; n < atoms.size(); n += 3)
+        cells.moveAtom(&atoms[n], n % 2 ? firstCell : lastCell);
+    for (auto &i : atoms)
+        if (i.cell() != lastCell)
+            cells.moveAtom(&i, lastCell);
+
+    // Every atom must appear exactly once, within the range of its own cell
+    auto nStored = 0;
+    for (auto n = 0; n < cells.nCells(); ++n)
+        for (const auto *i : cells.cell(n)->atoms())
+        {
+            EXPECT_EQ(i->cell(), cells.cell(n));
+            ++nStored;
+        }
+    EXPECT_EQ(nStored, atoms.size());
+    EXPECT_EQ(lastCell->nAtoms(), atoms.size());
+    EXPECT_EQ(std::count(cells.atoms().begin(), cells.atoms().end(), nullptr), cells.atoms().size() - atoms.size());
+
+    // Move some atoms within the last cell - the coordinate block must mirror the storage slots and current coordinates
+    for (auto n = 0; n < atoms.size(); n += 7)
+    {
+        atoms[n].setCoordinates(atoms[n].r() + Vec3<double>(0.1, 0.0, -0.1));
+        cells.updateCoordinates(&atoms[n]);
+    }
+    auto &coords = cells.coordinates();
+    ASSERT_EQ(coords.nSlots(), cells.atoms().size());
+    EXPECT_EQ(coords.nAtoms(), atoms.size());
+    for (auto n = 0; n < cells.nCells(); ++n)
+    {
+        EXPECT_EQ(coords.cellBegin(n), cells.cell(n)->atomsBegin());
+        EXPECT_EQ(coords.cellEnd(n), cells.cell(n)->atomsEnd());
+    }
+    for (auto slot = 0; slot < coords.nSlots(); ++slot)
+    {
+        auto *i = cells.atoms()[slot];
+        EXPECT_EQ(coords.atoms()[slot], i);
+        if (!i)
+            continue;
+        EXPECT_EQ(coords.globalIndices()[slot], i - atoms.data());
+        EXPECT_NEAR((coords.r(slot) - i->r()).magnitude(), 0.0, 1.0e-12);
+    }
+}
+
+TEST(CellsTest, DomainDecomposition)
+{
+    CoreData coreData;
+    auto *cfg = coreData.addConfiguration();
+    cfg->createBoxAndCells({60, 20, 20}, {90, 90, 90}, false, 9.0);
+    cfg->cells().generate(cfg->box(), 5.0, 9.0);
+    const auto &cells = cfg->cells();
+    auto nGrid = cells.divisions().x;
+    auto extent = cells.extents().x;
+    ASSERT_EQ(nGrid, 12);
+    ASSERT_EQ(extent, 2);
+
+    // Box too small to decompose
+    auto *smallCfg = coreData.addConfiguration();
+    smallCfg->createBoxAndCells({20, 20, 20}, {90, 90, 90}, false, 9.0);
+    smallCfg->cells().generate(smallCfg->box(), 5.0, 9.0);
+    EXPECT_EQ(DomainDecomposition(smallCfg->cells()).nDomains(), 0);
+
+    for (auto offset = 0; offset < nGrid; ++offset)
+    {
+        DomainDecomposition domains(cells, offset);
+        ASSERT_EQ(domains.nDomains(), 6);
+
+        // Get colour of each concurrent domain
+        std::vector<int> colours(domains.nDomains(), -1);
+        for (auto colour : {0, 1})
+            for (auto n : domains.concurrentDomains(colour))
+                colours[n] = colour;
+        EXPECT_LE(std::count(colours.begin(), colours.end(), -1), 1);
+
+        // Each concurrent domain must occupy a contiguous range of cell indices, and concurrent domains of the same colour
+        // must be separated by more than the cell neighbour extent
+        std::vector<int> firstCell(domains.nDomains(), -1), lastCell(domains.nDomains(), -1), nCells(domains.nDomains(), 0);
+        for (auto n = 0; n < cells.nCells(); ++n)
+        {
+            auto *cell = cells.cell(n);
+            auto cellDomain = domains.domain(cell);
+            if (colours[cellDomain] == -1)
+                continue;
+            if (firstCell[cellDomain] == -1)
+                firstCell[cellDomain] = n;
+            lastCell[cellDomain] = n;
+            ++nCells[cellDomain];
+            for (auto delta = 1; delta <= extent; ++delta)
+            {
+                auto otherDomain = domains.domain(
+                    cells.cell(cell->gridReference().x + delta, cell->gridReference().y, cell->gridReference().z));
+                if (otherDomain != cellDomain)
+                    EXPECT_NE(colours[otherDomain], colours[cellDomain]);
+            }
+        }
+        for (auto n = 0; n < domains.nDomains(); ++n)
+            if (colours[n] != -1)
+                EXPECT_EQ(lastCell[n] - firstCell[n] + 1, nCells[n]);
     }
 }
 
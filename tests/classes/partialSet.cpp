@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/partialSet.h"
+#include "classes/atomType.h"
+#include "math/ft.h"
+#include "tests/testData.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <tuple>
+#include <vector>
+
+namespace UnitTest
+{
+// Return sine Fourier transform of the supplied data, less the given offset, by direct quadrature
+std::vector<double> directFT(const Data1D &data, double offset, double normFactor, double wMin, double wStep, double wMax,
+                             WindowFunction windowFunction, const Function1DWrapper &broadening)
+{
+    windowFunction.setUp(data);
+    const auto &x = data.xAxis();
+    const auto &y = data.values();
+    std::vector<double> ft;
+    for (auto n = 0; n < int((wMax - wMin) / wStep); ++n)
+    {
+        auto omega = wMin + n * wStep;
+        auto sum = 0.0;
+        for (auto i = 0; i < x.size() - 1; ++i)
+            sum += x[i] * (y[i] - offset) * (x[i + 1] - x[i]) * (omega > 0.0 ? sin(x[i] * omega) : 1.0) *
+                   windowFunction.y(x[i], omega) *
+                   (broadening.form() == Functions1D::Form::None ? 1.0 : broadening.yFT(x[i], omega));
+        ft.push_back((omega > 0.0 ? sum / omega : sum) * normFactor);
+    }
+    return ft;
+}
+
+TEST(PartialSetTest, SineFT)
+{
+    SmallMolecules molecules_;
+    AtomTypeMix mix_;
+    mix_.add(molecules_.atN(), 1);
+    mix_.add(molecules_.atOW(), 2);
+    mix_.add(molecules_.atHW(), 3);
+    mix_.finalise();
+
+    // Generate distinct partials on a common abscissa
+    PartialSet gr;
+    gr.setUpPartials(mix_);
+    auto phase = 0.0;
+    for (auto i = 0; i < mix_.nItems(); ++i)
+        for (auto j = i; j < mix_.nItems(); ++j)
+            for (auto *partial : {&gr.partial(i, j), &gr.boundPartial(i, j), &gr.unboundPartial(i, j)})
+            {
+                phase += 0.1;
+                for (auto x = 0.025; x < 15.0; x += 0.05)
+                    partial->addPoint(x, 1.0 + exp(-0.2 * x) * sin(3.0 * x + phase));
+            }
+
+    // Transform with omega-dependent broadening (direct kernel) and onto an offset grid with omega-independent broadening
+    // (chirp-z)
+    const auto windowFunction = WindowFunction(WindowFunction::Form::Lorch0);
+    for (auto &&[broadening, wMin, method] :
+         {std::tuple<Function1DWrapper, double, Fourier::SineTransformPlan::Method>{
+              Function1DWrapper(Functions1D::Form::GaussianC2, {0.02, 0.01}), 0.5, Fourier::SineTransformPlan::Method::Kernel},
+          std::tuple<Function1DWrapper, double, Fourier::SineTransformPlan::Method>{
+              Function1DWrapper(Functions1D::Form::Gaussian, {0.1}), 1.33, Fourier::SineTransformPlan::Method::ChirpZ}})
+    {
+        ASSERT_EQ(Fourier::sineTransformPlan(gr.partial(0, 0), wMin, 0.05, 20.0, windowFunction, broadening)->method(),
+                  method);
+
+        PartialSet sq;
+        sq.setUpPartials(mix_);
+        EXPECT_TRUE(sq.sineFT(gr, 0.5, wMin, 0.05, 20.0, windowFunction, broadening, 1.0));
+
+        // Compare against direct quadrature, where only the full and unbound partials are offset
+        for (auto i = 0; i < mix_.nItems(); ++i)
+            for (auto j = i; j < mix_.nItems(); ++j)
+                for (auto &&[source, result, offset] :
+                     {std::tuple<const Data1D &, const Data1D &, double>{gr.partial(i, j), sq.partial(i, j), 1.0},
+                      std::tuple<const Data1D &, const Data1D &, double>{gr.boundPartial(i, j), sq.boundPartial(i, j), 0.0},
+                      std::tuple<const Data1D &, const Data1D &, double>{gr.unboundPartial(i, j), sq.unboundPartial(i, j),
+                                                                         1.0}})
+                {
+                    auto reference = directFT(source, offset, 0.5, wMin, 0.05, 20.0, windowFunction, broadening);
+                    ASSERT_EQ(result.nValues(), reference.size());
+                    for (auto n = 0; n < reference.size(); ++n)
+                    {
+                        EXPECT_NEAR(result.xAxis(n), wMin + n * 0.05, 1.0e-12);
+                        EXPECT_NEAR(result.value(n), reference[n], 1.0e-10);
+                    }
+                }
+    }
+}
+} // namespace UnitTest
@@ -90,4 +90,41 @@ TEST(SpeciesTest, Molecule2)
     EXPECT_EQ(sp.nAtoms(), 0);
 }
 
+TEST(SpeciesTest, ScaledInteractions)
+{
+    // Linear pentane skeleton
+    Species sp;
+    for (auto n = 0; n < 5; ++n)
+        sp.addAtom(Elements::C, {n * 1.26, (n % 2) * 0.89, 0.0});
+    sp.addMissingBonds();
+    sp.updateIntramolecularTerms();
+    ASSERT_EQ(sp.nTorsions(), 2);
+    sp.torsions().front().set14ScalingFactors(0.25, 0.75);
+    sp.setUpScaledInteractions();
+
+    // Scaled interactions must be symmetric, and identical to those searched for on the individual atoms
+    auto checkScaling = [&](int i, int j, SpeciesAtom::ScaledInteraction type, double elecScale, double srScale)
+    {
+        for (auto &&[a, b] : {std::pair{i, j}, std::pair{j, i}})
+        {
+            auto &&[scalingType, elec14, vdw14] = sp.atom(a).scaling(&sp.atom(b));
+            EXPECT_EQ(scalingType, type);
+            EXPECT_DOUBLE_EQ(elec14, elecScale);
+            EXPECT_DOUBLE_EQ(vdw14, srScale);
+        }
+    };
+    checkScaling(0, 1, SpeciesAtom::ScaledInteraction::Excluded, 0.0, 0.0);
+    checkScaling(0, 2, SpeciesAtom::ScaledInteraction::Excluded, 0.0, 0.0);
+    checkScaling(0, 3, SpeciesAtom::ScaledInteraction::Scaled, 0.25, 0.75);
+    checkScaling(1, 4, SpeciesAtom::ScaledInteraction::Scaled, 0.5, 0.5);
+    checkScaling(0, 4, SpeciesAtom::ScaledInteraction::NotScaled, 1.0, 1.0);
+
+    // Atoms in a different species are never scaled
+    Species other;
+    other.addAtom(Elements::C, {});
+    other.setUpScaledInteractions();
+    auto &&[scalingType, elec14, vdw14] = sp.atom(0).scaling(&other.atom(0));
+    EXPECT_EQ(scalingType, SpeciesAtom::ScaledInteraction::NotScaled);
+}
+
 } // namespace UnitTest
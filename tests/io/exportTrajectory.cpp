@@ -5,7 +5,9 @@
 #include "base/sysFunc.h"
 #include "data/elements.h"
 #include "io/export/trajectory.h"
+#include "io/import/trajectory.h"
 #include "tests/testData.h"
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <vector>
@@ -109,4 +111,42 @@ TEST_F(ExportTrajectoryTest, XYZExport)
     }
 }
 
+TEST_F(ExportTrajectoryTest, Binary)
+{
+    for (auto format : {TrajectoryExportFileFormat::TrajectoryExportFormat::Binary32,
+                        TrajectoryExportFileFormat::TrajectoryExportFormat::Binary64})
+    {
+        auto outfile = fmt::format("TestOutput_exportTrajectory.{}",
+                                   TrajectoryExportFileFormat::trajectoryExportFormats().keyword(format));
+        std::filesystem::remove(fmt::format("dissolve/input/{}", outfile));
+
+        // Write two frames, displacing the first atom between them
+        exportFile(systemTest, outfile, format);
+        auto *cfg = systemTest.coreData().configuration(0);
+        auto r0 = cfg->atoms()[0].r();
+        cfg->atoms()[0].translateCoordinates({1.0, 2.0, 3.0});
+        TrajectoryExportFileFormat exporter(fmt::format("dissolve/input/{}", outfile), format);
+        ASSERT_TRUE(exporter.exportData(cfg));
+
+        // Read the frames back in sequence
+        auto tolerance = format == TrajectoryExportFileFormat::TrajectoryExportFormat::Binary32 ? 1.0e-4 : 1.0e-12;
+        LineParser parser;
+        ASSERT_TRUE(parser.openInput(fmt::format("dissolve/input/{}", outfile)));
+        TrajectoryImportFileFormat importer("", TrajectoryImportFileFormat::TrajectoryImportFormat::Binary);
+        for (auto frame = 0; frame < 2; ++frame)
+        {
+            cfg->atoms()[0].setCoordinates({0.0, 0.0, 0.0});
+            std::optional<Matrix3> unitCell;
+            ASSERT_TRUE(importer.importData(parser, cfg, unitCell));
+            ASSERT_TRUE(unitCell);
+            EXPECT_NEAR((unitCell.value() - cfg->box()->axes()).maxAbs(), 0.0, 1.0e-12);
+            auto expected = frame == 0 ? r0 : r0 + Vec3<double>(1.0, 2.0, 3.0);
+            EXPECT_NEAR(cfg->atoms()[0].x(), expected.x, tolerance);
+            EXPECT_NEAR(cfg->atoms()[0].y(), expected.y, tolerance);
+            EXPECT_NEAR(cfg->atoms()[0].z(), expected.z, tolerance);
+        }
+        EXPECT_TRUE(parser.eofOrBlank());
+    }
+}
+
 } // namespace UnitTest
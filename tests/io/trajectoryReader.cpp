@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "io/binaryTrajectory.h"
+#include "io/import/trajectoryReader.h"
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+namespace UnitTest
+{
+class TrajectoryReaderTest : public ::testing::Test
+{
+    protected:
+    static constexpr int nAtoms_ = 3;
+
+    // Return expected coordinates of specified atom in frame
+    static Vec3<double> expected(int frame, int atom) { return {frame + 0.125, atom * 1.5, -0.25 * frame - atom}; }
+    // Return XYZ representation of specified frame
+    static std::string xyzFrame(int frame)
+    {
+        auto text = fmt::format("{}\nFrame {}\n", nAtoms_, frame);
+        for (auto i = 0; i < nAtoms_; ++i)
+        {
+            auto r = expected(frame, i);
+            text += fmt::format("Ar  {}  {}  {}\n", r.x, r.y, r.z);
+        }
+        return text;
+    }
+    // Return DL_POLY HISTORY representation of specified frame, including velocities
+    static std::string dlpolyFrame(int frame)
+    {
+        auto text = fmt::format("timestep {:10d} {:10d} {:10d} {:10d} {:12.6f}\n", frame, nAtoms_, 1, 1, 0.001);
+        text += "  1.0000000000E+01  0.0000000000E+00  0.0000000000E+00\n";
+        text += "  0.0000000000E+00  1.1000000000E+01  0.0000000000E+00\n";
+        text += "  0.0000000000E+00  0.0000000000E+00  1.2000000000E+01\n";
+        for (auto i = 0; i < nAtoms_; ++i)
+        {
+            auto r = expected(frame, i);
+            text += fmt::format("Ar {:10d} {:12.6f}\n{} {} {}\n  0.0D+00  0.0D+00  0.0D+00\n", i + 1, 39.948, r.x, r.y, r.z);
+        }
+        return text;
+    }
+    // Return binary representation of specified frame
+    static std::string binaryFrame(int frame)
+    {
+        BinaryTrajectory::FrameHeader header;
+        header.index = frame;
+        header.nAtoms = nAtoms_;
+        header.axes = {10.0, 0.0, 0.0, 0.0, 11.0, 0.0, 0.0, 0.0, 12.0};
+        std::string data(reinterpret_cast<const char *>(&header), sizeof(header));
+        for (auto i = 0; i < nAtoms_; ++i)
+        {
+            auto r = expected(frame, i);
+            double xyz[3] = {r.x, r.y, r.z};
+            data.append(reinterpret_cast<const char *>(xyz), sizeof(xyz));
+        }
+        return data;
+    }
+    // Return binary file header
+    static std::string binaryHeader()
+    {
+        BinaryTrajectory::FileHeader header;
+        header.nAtoms = nAtoms_;
+        return std::string(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+
+    // Write (or append) specified contents to the named file
+    static void writeFile(const std::string &filename, const std::string &contents, bool append = false)
+    {
+        std::ofstream file(filename, append ? std::ios::binary | std::ios::app : std::ios::binary);
+        file << contents;
+    }
+
+    // Check specified frame read from the reader
+    static void checkFrame(TrajectoryReader &reader, int frame, bool hasUnitCell)
+    {
+        auto optFrame = reader.read(frame);
+        ASSERT_TRUE(optFrame);
+        ASSERT_EQ(optFrame->r.size(), nAtoms_);
+        for (auto i = 0; i < nAtoms_; ++i)
+        {
+            auto r = expected(frame, i);
+            EXPECT_DOUBLE_EQ(optFrame->r[i].x, r.x);
+            EXPECT_DOUBLE_EQ(optFrame->r[i].y, r.y);
+            EXPECT_DOUBLE_EQ(optFrame->r[i].z, r.z);
+        }
+        EXPECT_EQ(optFrame->unitCell.has_value(), hasUnitCell);
+        if (hasUnitCell)
+        {
+            EXPECT_DOUBLE_EQ(optFrame->unitCell->columnAsVec3(0).x, 10.0);
+            EXPECT_DOUBLE_EQ(optFrame->unitCell->columnAsVec3(1).y, 11.0);
+            EXPECT_DOUBLE_EQ(optFrame->unitCell->columnAsVec3(2).z, 12.0);
+        }
+    }
+
+    // Test reading of a trajectory which is still being written, starting with a truncated final frame
+    template <class F>
+    void testGrowingFile(const std::string &filename, TrajectoryImportFileFormat::TrajectoryImportFormat format,
+                         const std::string &header, F frameGenerator, bool hasUnitCell)
+    {
+        // Write three complete frames and half of a fourth
+        auto fourthFrame = frameGenerator(3);
+        writeFile(filename, header + frameGenerator(0) + frameGenerator(1) + frameGenerator(2) +
+                                fourthFrame.substr(0, fourthFrame.size() / 2));
+
+        TrajectoryReader reader;
+        ASSERT_TRUE(reader.open(filename, format));
+        EXPECT_TRUE(reader.isOpen(filename, format));
+        ASSERT_EQ(reader.nFrames(), 3);
+        for (auto frame = 0; frame < 3; ++frame)
+            checkFrame(reader, frame, hasUnitCell);
+        EXPECT_FALSE(reader.read(3));
+
+        // Reading frames out of order, with and without prefetching, gives the same results
+        reader.prefetch(2);
+        checkFrame(reader, 2, hasUnitCell);
+        reader.prefetch(1);
+        checkFrame(reader, 0, hasUnitCell);
+
+        // Complete the fourth frame and add a fifth - checking the file should index only the new frames
+        writeFile(filename, fourthFrame.substr(fourthFrame.size() / 2) + frameGenerator(4), true);
+        EXPECT_TRUE(reader.isOpen(filename, format));
+        ASSERT_EQ(reader.nFrames(), 5);
+        for (auto frame = 0; frame < 5; ++frame)
+            checkFrame(reader, frame, hasUnitCell);
+
+        // The file is no longer considered open if it has shrunk, or is requested in a different format
+        EXPECT_FALSE(reader.isOpen(filename, format == TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ
+                                                 ? TrajectoryImportFileFormat::TrajectoryImportFormat::Binary
+                                                 : TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ));
+        writeFile(filename, header + frameGenerator(0));
+        EXPECT_FALSE(reader.isOpen(filename, format));
+        ASSERT_TRUE(reader.open(filename, format));
+        EXPECT_EQ(reader.nFrames(), 1);
+
+        reader.close();
+        std::filesystem::remove(filename);
+    }
+};
+
+TEST_F(TrajectoryReaderTest, XYZ)
+{
+    testGrowingFile("TestOutput_trajectoryReader.xyz", TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ, "", xyzFrame,
+                    false);
+}
+
+TEST_F(TrajectoryReaderTest, DLPOLY)
+{
+    testGrowingFile("TestOutput_trajectoryReader.HISTORY", TrajectoryImportFileFormat::TrajectoryImportFormat::DLPOLYFormatted,
+                    "", dlpolyFrame, true);
+}
+
+TEST_F(TrajectoryReaderTest, Binary)
+{
+    testGrowingFile("TestOutput_trajectoryReader.dtrj", TrajectoryImportFileFormat::TrajectoryImportFormat::Binary,
+                    binaryHeader(), binaryFrame, true);
+}
+
+TEST_F(TrajectoryReaderTest, FrameAt)
+{
+    const std::string filename = "TestOutput_trajectoryReader.frameAt.xyz";
+    writeFile(filename, xyzFrame(0) + "\n" + xyzFrame(1));
+
+    TrajectoryReader reader;
+    ASSERT_TRUE(reader.open(filename, TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ));
+    ASSERT_EQ(reader.nFrames(), 2);
+
+    // Blank lines between frames are skipped, so the second frame starts after them
+    EXPECT_EQ(reader.frameAt(0), 0);
+    EXPECT_EQ(reader.frameAt(xyzFrame(0).size() + 1), 1);
+    EXPECT_FALSE(reader.frameAt(xyzFrame(0).size()));
+
+    reader.close();
+    std::filesystem::remove(filename);
+}
+
+TEST_F(TrajectoryReaderTest, Invalid)
+{
+    const std::string filename = "TestOutput_trajectoryReader.invalid.dtrj";
+    writeFile(filename, "Not a binary trajectory at all");
+
+    TrajectoryReader reader;
+    EXPECT_FALSE(reader.open(filename, TrajectoryImportFileFormat::TrajectoryImportFormat::Binary));
+    EXPECT_FALSE(reader.open(filename, TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ));
+    EXPECT_FALSE(reader.isOpen(filename, TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ));
+
+    // Frames must contain at least one atom
+    for (auto &&[contents, format] :
+         {std::pair<std::string, TrajectoryImportFileFormat::TrajectoryImportFormat>{
+              "0\nEmpty\n", TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ},
+          std::pair<std::string, TrajectoryImportFileFormat::TrajectoryImportFormat>{
+              "-3\nNegative\n", TrajectoryImportFileFormat::TrajectoryImportFormat::XYZ},
+          std::pair<std::string, TrajectoryImportFileFormat::TrajectoryImportFormat>{
+              "timestep 1 0 1 1 0.001\n", TrajectoryImportFileFormat::TrajectoryImportFormat::DLPOLYFormatted}})
+    {
+        writeFile(filename, contents);
+        EXPECT_FALSE(reader.open(filename, format)) << contents;
+    }
+
+    std::filesystem::remove(filename);
+}
+} // namespace UnitTest
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "math/ft.h"
+#include "math/data1D.h"
+#include "math/function1D.h"
+#include "math/windowFunction.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+class FourierTest : public ::testing::Test
+{
+    public:
+    FourierTest() = default;
+
+    // Generate test function on a uniform grid of bin centres
+    Data1D generate(double phase = 0.0, double xMax = 20.0, double xDelta = 0.025)
+    {
+        Data1D d;
+        for (auto x = 0.5 * xDelta; x < xMax; x += xDelta)
+            d.addPoint(x, exp(-0.1 * x) * sin(2.0 * x + phase));
+        return d;
+    }
+
+    // Direct sine transform of supplied data
+    std::vector<double> directFT(const Data1D &data, double normFactor, double wMin, double wStep, double wMax,
+                                 WindowFunction windowFunction, const Function1DWrapper &broadening)
+    {
+        windowFunction.setUp(data);
+        const auto &x = data.xAxis();
+        const auto &y = data.values();
+        std::vector<double> ft;
+        for (auto n = 0; n < int((wMax - wMin) / wStep); ++n)
+        {
+            auto omega = wMin + n * wStep;
+            auto sum = 0.0;
+            for (auto i = 0; i < x.size() - 1; ++i)
+                sum += x[i] * y[i] * (x[i + 1] - x[i]) * (omega > 0.0 ? sin(x[i] * omega) : 1.0) *
+                       windowFunction.y(x[i], omega) *
+                       (broadening.form() == Functions1D::Form::None ? 1.0 : broadening.yFT(x[i], omega));
+            ft.push_back((omega > 0.0 ? sum / omega : sum) * normFactor);
+        }
+        return ft;
+    }
+};
+
+TEST_F(FourierTest, SineFT)
+{
+    for (auto &broadening : {Function1DWrapper(), Function1DWrapper(Functions1D::Form::Gaussian, {0.1}),
+                             Function1DWrapper(Functions1D::Form::GaussianC2, {0.02, 0.01})})
+        for (auto form : {WindowFunction::Form::None, WindowFunction::Form::Lorch0, WindowFunction::Form::Hann})
+        {
+            auto data = generate();
+            auto reference = directFT(data, 0.5, 0.0, 0.05, 30.0, WindowFunction(form), broadening);
+            Fourier::sineFT(data, 0.5, 0.0, 0.05, 30.0, WindowFunction(form), broadening);
+            ASSERT_EQ(data.nValues(), reference.size());
+            for (auto n = 0; n < reference.size(); ++n)
+            {
+                EXPECT_NEAR(data.xAxis(n), n * 0.05, 1.0e-12);
+                EXPECT_NEAR(data.value(n), reference[n], 1.0e-10);
+            }
+        }
+}
+
+TEST_F(FourierTest, ChirpZ)
+{
+    // Offset target grids starting between steps, with and without omega-independent broadening
+    for (auto &broadening : {Function1DWrapper(), Function1DWrapper(Functions1D::Form::Gaussian, {0.1}),
+                             Function1DWrapper(Functions1D::Form::ScaledGaussian, {2.0, 0.1})})
+        for (auto wMin : {0.05, 1.33, 7.5})
+        {
+            auto data = generate();
+            const auto windowFunction = WindowFunction(WindowFunction::Form::Lorch0);
+            auto plan = Fourier::sineTransformPlan(data, wMin, 0.05, 30.0, windowFunction, broadening);
+            ASSERT_EQ(plan->method(), Fourier::SineTransformPlan::Method::ChirpZ);
+            auto reference = directFT(data, 0.5, wMin, 0.05, 30.0, windowFunction, broadening);
+            ASSERT_EQ(plan->w().size(), reference.size());
+            std::vector<double> result(plan->w().size());
+            plan->transform(data.values(), result, 0.5);
+            for (auto n = 0; n < reference.size(); ++n)
+            {
+                EXPECT_NEAR(plan->w()[n], wMin + n * 0.05, 1.0e-12);
+                EXPECT_NEAR(result[n], reference[n], 1.0e-10);
+            }
+        }
+}
+
+TEST_F(FourierTest, Methods)
+{
+    const auto windowFunction = WindowFunction(WindowFunction::Form::Lorch0);
+    auto uniform = generate();
+
+    // Uniform data with omega-independent broadening can use the chirp-z transform
+    EXPECT_EQ(Fourier::sineTransformPlan(uniform, 0.05, 0.05, 30.0, windowFunction, Function1DWrapper())->method(),
+              Fourier::SineTransformPlan::Method::ChirpZ);
+    EXPECT_EQ(Fourier::sineTransformPlan(uniform, 0.05, 0.05, 30.0, windowFunction,
+                                         Function1DWrapper(Functions1D::Form::Gaussian, {0.1}))
+                  ->method(),
+              Fourier::SineTransformPlan::Method::ChirpZ);
+
+    // Omega-dependent broadening requires the kernel
+    EXPECT_EQ(Fourier::sineTransformPlan(uniform, 0.05, 0.05, 30.0, windowFunction,
+                                         Function1DWrapper(Functions1D::Form::OmegaDependentGaussian, {0.02}))
+                  ->method(),
+              Fourier::SineTransformPlan::Method::Kernel);
+    EXPECT_EQ(Fourier::sineTransformPlan(uniform, 0.05, 0.05, 30.0, windowFunction,
+                                         Function1DWrapper(Functions1D::Form::GaussianC2, {0.02, 0.01}))
+                  ->method(),
+              Fourier::SineTransformPlan::Method::Kernel);
+
+    // As does a non-uniform abscissa
+    Data1D nonUniform;
+    for (auto x = 0.01; x < 20.0; x *= 1.01)
+        nonUniform.addPoint(x, exp(-0.1 * x) * sin(2.0 * x));
+    auto plan = Fourier::sineTransformPlan(nonUniform, 0.05, 0.05, 30.0, windowFunction, Function1DWrapper());
+    EXPECT_EQ(plan->method(), Fourier::SineTransformPlan::Method::Kernel);
+    auto reference = directFT(nonUniform, 0.5, 0.05, 0.05, 30.0, windowFunction, Function1DWrapper());
+    std::vector<double> result(plan->w().size());
+    plan->transform(nonUniform.values(), result, 0.5);
+    for (auto n = 0; n < reference.size(); ++n)
+        EXPECT_NEAR(result[n], reference[n], 1.0e-10);
+
+    // Small transforms are cheaper with the kernel
+    EXPECT_EQ(Fourier::sineTransformPlan(generate(0.0, 2.0, 0.1), 0.05, 0.5, 5.0, windowFunction, Function1DWrapper())
+                  ->method(),
+              Fourier::SineTransformPlan::Method::Kernel);
+}
+
+TEST_F(FourierTest, PlanCache)
+{
+    const auto data = generate();
+    const auto broadening = Function1DWrapper(Functions1D::Form::GaussianC2, {0.02, 0.01});
+
+    // Identical requests should share a plan
+    auto plan = Fourier::sineTransformPlan(data, 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0), broadening);
+    EXPECT_EQ(plan, Fourier::sineTransformPlan(data, 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0),
+                                               Function1DWrapper(Functions1D::Form::GaussianC2, {0.02, 0.01})));
+
+    // Changes to the grids, window, or broadening should not
+    EXPECT_NE(plan, Fourier::sineTransformPlan(generate(0.0, 15.0), 0.05, 0.05, 30.0,
+                                               WindowFunction(WindowFunction::Form::Lorch0), broadening));
+    EXPECT_NE(plan,
+              Fourier::sineTransformPlan(data, 0.05, 0.1, 30.0, WindowFunction(WindowFunction::Form::Lorch0), broadening));
+    EXPECT_NE(plan, Fourier::sineTransformPlan(data, 0.05, 0.05, 30.0, WindowFunction(), broadening));
+    EXPECT_NE(plan, Fourier::sineTransformPlan(data, 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0),
+                                               Function1DWrapper(Functions1D::Form::GaussianC2, {0.03, 0.01})));
+}
+
+TEST_F(FourierTest, MultipleTransform)
+{
+    std::vector<Data1D> sources{generate(0.0), generate(0.5), generate(1.0)};
+    auto plan = Fourier::sineTransformPlan(sources.front(), 0.05, 0.05, 30.0, WindowFunction(WindowFunction::Form::Lorch0),
+                                           Function1DWrapper());
+
+    std::vector<std::vector<double>> results(sources.size(), std::vector<double>(plan->w().size()));
+    std::vector<const double *> ys;
+    std::vector<double *> dests;
+    for (auto n = 0; n < sources.size(); ++n)
+    {
+        ys.push_back(sources[n].values().data());
+        dests.push_back(results[n].data());
+    }
+    plan->transform(ys, dests, 2.0);
+
+    for (auto n = 0; n < sources.size(); ++n)
+    {
+        std::vector<double> single(plan->w().size());
+        plan->transform(sources[n].values(), single, 2.0);
+        for (auto i = 0; i < single.size(); ++i)
+            EXPECT_DOUBLE_EQ(results[n][i], single[i]);
+    }
+}
+} // namespace UnitTest
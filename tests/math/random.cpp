@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/randomStream.h"
+#include "math/philox.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace UnitTest
+{
+
+TEST(RandomTest, PhiloxKnownAnswers)
+{
+    // Known answer tests from the Random123 distribution
+    EXPECT_EQ(Philox::generate({0, 0, 0, 0}, {0, 0}), Philox::Counter({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              Philox::Counter({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              Philox::Counter({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(RandomTest, Streams)
+{
+    const auto nValues = 1001;
+    auto draw = [nValues](RandomStream &stream)
+    {
+        std::vector<double> values(nValues);
+        std::generate(values.begin(), values.end(), [&]() { return stream.random(); });
+        return values;
+    };
+
+    // Streams with the same key are identical, and those with different units differ
+    RandomStream streamA(12345, 1), streamB(12345, 1), streamC(12345, 2);
+    auto valuesA = draw(streamA);
+    EXPECT_EQ(valuesA, draw(streamB));
+    EXPECT_NE(valuesA, draw(streamC));
+    EXPECT_TRUE(std::all_of(valuesA.begin(), valuesA.end(), [](const auto x) { return x >= 0.0 && x < 1.0; }));
+
+    // Mean should be close to one half
+    auto sum = 0.0;
+    for (auto x : valuesA)
+        sum += x;
+    EXPECT_NEAR(sum / nValues, 0.5, 0.05);
+
+    // Bulk fill, started part way through a block, must reproduce the sequential values
+    RandomStream streamD(12345, 1);
+    std::vector<double> valuesD(nValues);
+    valuesD[0] = streamD.random();
+    streamD.fill(valuesD.data() + 1, valuesD.data() + nValues);
+    EXPECT_EQ(valuesA, valuesD);
+    EXPECT_EQ(streamA.random(), streamD.random());
+
+    // Task streams are reproducible, and independent of each other and of their parent
+    RandomStream parentA(12345, 1), parentB(12345, 1);
+    auto taskA1 = parentA.createTaskStream(), taskA2 = parentA.createTaskStream();
+    auto taskB1 = parentB.createTaskStream();
+    auto valuesTaskA1 = draw(taskA1);
+    EXPECT_EQ(valuesTaskA1, draw(taskB1));
+    EXPECT_NE(valuesTaskA1, draw(taskA2));
+    EXPECT_NE(valuesTaskA1, draw(parentA));
+}
+
+} // namespace UnitTest
@@ -1,6 +1,13 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // Copyright (c) 2024 Team Dissolve and contributors
 
+#include "classes/atomType.h"
+#include "classes/box.h"
+#include "classes/cell.h"
+#include "classes/domainDecomposition.h"
+#include "classes/species.h"
+#include "module/context.h"
+#include "modules/atomShake/atomShake.h"
 #include "tests/testData.h"
 #include <gtest/gtest.h>
 #include <vector>
@@ -29,4 +36,64 @@ TEST_F(AtomShakeModuleTest, Water)
     EXPECT_NEAR(box->angleInDegrees(atoms[1].r(), atoms[0].r(), atoms[2].r()), 113.24, 1.7e-2);
 }
 
+TEST(AtomShakeModuleDomainsTest, PackedCell)
+{
+    CoreData coreData;
+    Dissolve dissolve(coreData);
+    dissolve.setPairPotentialRange(9.0);
+    auto arType = coreData.addAtomType(Elements::Ar);
+    arType->setName("Ar");
+    arType->interactionPotential().setFormAndParameters(ShortRangeFunctions::Form::LennardJones, "epsilon=0.979 sigma=3.4");
+    auto *argon = coreData.addSpecies();
+    argon->setName("Argon");
+    argon->addAtom(Elements::Ar, {0.0, 0.0, 0.0}, 0.0, arType);
+
+    // Set up a configuration large enough to be decomposed into concurrent domains, with atoms on a regular grid
+    auto *cfg = coreData.addConfiguration();
+    cfg->createBoxAndCells({60, 20, 20}, {90, 90, 90}, false, dissolve.pairPotentialRange());
+    for (auto n = 0; n < 375; ++n)
+        cfg->addMolecule(argon);
+    ASSERT_TRUE(dissolve.prepare());
+    cfg->cells().generate(cfg->box(), 5.0, dissolve.pairPotentialRange());
+    for (auto n = 0; n < cfg->nAtoms(); ++n)
+        cfg->atom(n).setCoordinates(4.0 * (n % 15) + 0.5, 4.0 * ((n / 15) % 5) + 0.5, 4.0 * (n / 75) + 0.5);
+    cfg->updateObjectRelationships();
+    ASSERT_GT(DomainDecomposition(cfg->cells()).nDomains(), 0);
+
+    // Pack the first cell to its slot limit with atoms taken from the far end of the box
+    auto *packedCell = cfg->cells().cell(0);
+    auto source = cfg->nAtoms() - 1;
+    std::vector<Vec3<double>> packedCoordinates = {{2.5, 2.5, 2.5}, {2.5, 0.5, 2.5}, {0.5, 2.5, 2.5},
+                                                   {2.5, 2.5, 0.5}, {2.5, 2.5, 4.5}, {4.5, 2.5, 2.5},
+                                                   {2.5, 4.5, 2.5}, {0.5, 0.5, 2.5}, {4.5, 4.5, 2.5}};
+    for (auto &r : packedCoordinates)
+    {
+        if (packedCell->nFreeSlots() == 0)
+            break;
+        cfg->atom(source).setCoordinates(r);
+        cfg->updateAtomLocation(&cfg->atom(source--));
+    }
+    ASSERT_EQ(packedCell->nFreeSlots(), 0);
+
+    // Shake with large steps so that atoms cross cell boundaries frequently, in both directions
+    AtomShakeModule module;
+    module.keywords().set("Configuration", cfg);
+    module.keywords().set("StepSize", 1.0);
+    module.keywords().set("StepSizeMin", 1.0);
+    ModuleContext context(dissolve.worldPool(), dissolve);
+    for (auto n = 0; n < 10; ++n)
+        ASSERT_NO_THROW_VERBOSE(EXPECT_EQ(module.executeProcessing(context), Module::ExecutionResult::Success));
+
+    // Every atom must appear exactly once, within the range of the cell containing it
+    auto nStored = 0;
+    for (auto n = 0; n < cfg->cells().nCells(); ++n)
+        for (const auto *i : cfg->cells().cell(n)->atoms())
+        {
+            EXPECT_EQ(i->cell(), cfg->cells().cell(n));
+            EXPECT_EQ(i->cell(), cfg->cells().cell(i->r()));
+            ++nStored;
+        }
+    EXPECT_EQ(nStored, cfg->nAtoms());
+}
+
 } // namespace UnitTest
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "classes/atomOwnership.h"
+#include "classes/configuration.h"
+#include "main/dissolve.h"
+#include "modules/forces/forces.h"
+#include "tests/testData.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+/*
+ * Tests comparing the forces produced by the different communication strategies. In parallel builds these are run over several
+ * processes.
+ */
+
+namespace UnitTest
+{
+class ForcesParallelTest : public ::testing::Test
+{
+    protected:
+    DissolveSystemTest systemTest;
+
+    // Set up benzene system with positions identical on all processes
+    void setUpBenzene()
+    {
+        ASSERT_NO_THROW_VERBOSE(systemTest.setUp("dissolve/input/md-benzene.txt"));
+        ASSERT_NO_THROW_VERBOSE(systemTest.loadRestart("dissolve/input/md-benzene.8.reference.restart"));
+    }
+    // Check that the supplied energy and virial agree
+    static void checkEnergyAndVirial(const ForceKernel::EnergyAndVirial &ev, const ForceKernel::EnergyAndVirial &reference)
+    {
+        EXPECT_NEAR(ev.energy.interMolecular(), reference.energy.interMolecular(),
+                    1.0e-8 * std::abs(reference.energy.interMolecular()));
+        EXPECT_NEAR(ev.energy.intraMolecular(), reference.energy.intraMolecular(),
+                    1.0e-8 * std::abs(reference.energy.intraMolecular()));
+        EXPECT_NEAR(ev.virial, reference.virial, 1.0e-8 * std::abs(reference.virial));
+    }
+};
+
+TEST_F(ForcesParallelTest, OwnerComputes)
+{
+    ASSERT_NO_FATAL_FAILURE(setUpBenzene());
+    auto &procPool = systemTest.dissolve().worldPool();
+    const auto &potentialMap = systemTest.dissolve().potentialMap();
+    auto *cfg = systemTest.coreData().configuration(0);
+    const auto nAtoms = cfg->nAtoms();
+
+    // Reference forces, energy and virial, summed over all processes
+    std::vector<Vec3<double>> fUnbound(nAtoms), fBound(nAtoms);
+    ForceKernel::EnergyAndVirial reference;
+    ASSERT_TRUE(ForcesModule::totalForces(procPool, cfg, potentialMap, ForcesModule::ForceCalculationType::Full, fUnbound,
+                                          fBound, {}, {}, reference));
+    EXPECT_LT(reference.energy.interMolecular(), 0.0);
+
+    // Forces calculated by the owners of atoms, which must match the reference for every atom we own
+    AtomOwnership ownership(procPool, cfg, potentialMap.range());
+    std::vector<Vec3<double>> fOwnedUnbound(nAtoms), fOwnedBound(nAtoms);
+    ForceKernel::EnergyAndVirial owned;
+    ASSERT_TRUE(ForcesModule::totalForces(procPool, cfg, potentialMap, ForcesModule::ForceCalculationType::Full,
+                                          fOwnedUnbound, fOwnedBound, {}, {}, owned, ownership));
+    for (auto n : ownership.ownedAtoms())
+    {
+        EXPECT_NEAR((fOwnedUnbound[n] - fUnbound[n]).magnitude(), 0.0, 1.0e-8 * std::max(1.0, fUnbound[n].magnitude()));
+        EXPECT_NEAR((fOwnedBound[n] - fBound[n]).magnitude(), 0.0, 1.0e-8 * std::max(1.0, fBound[n].magnitude()));
+    }
+    checkEnergyAndVirial(owned, reference);
+
+    // Every atom must be owned by exactly one process
+    auto nOwned = int(ownership.ownedAtoms().size());
+    procPool.allSum(&nOwned, 1);
+    EXPECT_EQ(nOwned, nAtoms);
+}
+
+TEST_F(ForcesParallelTest, OverlappedReduction)
+{
+    ASSERT_NO_FATAL_FAILURE(setUpBenzene());
+    auto &procPool = systemTest.dissolve().worldPool();
+    const auto &potentialMap = systemTest.dissolve().potentialMap();
+    auto *cfg = systemTest.coreData().configuration(0);
+    const auto nAtoms = cfg->nAtoms();
+
+    // Reference forces calculated into a single array, reduced once all terms are complete
+    std::vector<Vec3<double>> f(nAtoms);
+    ForceKernel::EnergyAndVirial reference;
+    ASSERT_TRUE(ForcesModule::totalForces(procPool, cfg, potentialMap, ForcesModule::ForceCalculationType::Full, f, f, {}, {},
+                                          reference));
+
+    // With separate bound and unbound arrays over more than one process the reduction of the bound forces is overlapped with
+    // the calculation of the unbound forces
+    std::vector<Vec3<double>> fUnbound(nAtoms), fBound(nAtoms);
+    ForceKernel::EnergyAndVirial overlapped;
+    ASSERT_TRUE(ForcesModule::totalForces(procPool, cfg, potentialMap, ForcesModule::ForceCalculationType::Full, fUnbound,
+                                          fBound, {}, {}, overlapped));
+    for (auto n = 0; n < nAtoms; ++n)
+        EXPECT_NEAR((fUnbound[n] + fBound[n] - f[n]).magnitude(), 0.0, 1.0e-8 * std::max(1.0, f[n].magnitude()));
+    checkEnergyAndVirial(overlapped, reference);
+}
+} // namespace UnitTest
@@ -29,6 +29,27 @@ TEST_F(GRModuleTest, Methods)
     ASSERT_TRUE(systemTest.dissolve().iterate(1));
 }
 
+TEST_F(GRModuleTest, Incremental)
+{
+    ASSERT_NO_THROW_VERBOSE(systemTest.setUp("dissolve/input/rdfMethod.txt"));
+    auto *grModule = systemTest.getModule<GRModule>("GR01");
+    grModule->keywords().setEnumeration("Method", GRModule::PartialsMethod::CellsMethod);
+    ASSERT_NO_THROW_VERBOSE(grModule->keywords().set("Incremental", true));
+
+    // Full calculation to establish the reference data
+    ASSERT_TRUE(systemTest.dissolve().iterate(1));
+
+    // Move a subset of atoms - the partials will be updated incrementally, and checked by the internal test
+    auto *cfg = systemTest.coreData().configurations().front().get();
+    for (auto n = 0; n < cfg->nAtoms(); n += 50)
+    {
+        cfg->atoms()[n].translateCoordinates(0.37 * (n % 3), -1.1, 2.03);
+        cfg->updateAtomLocation(&cfg->atoms()[n]);
+    }
+    cfg->incrementContentsVersion();
+    ASSERT_TRUE(systemTest.dissolve().iterate(1));
+}
+
 TEST_F(GRModuleTest, Water)
 {
     ASSERT_NO_THROW_VERBOSE(systemTest.setUp("dissolve/input/correlations-water.txt"));
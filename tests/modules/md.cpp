@@ -2,6 +2,11 @@
 // Copyright (c) 2024 Team Dissolve and contributors
 
 #include "io/import/forces.h"
+#include "classes/configuration.h"
+#include "data/atomicMasses.h"
+#include "main/dissolve.h"
+#include "modules/energy/energy.h"
+#include "modules/md/md.h"
 #include "tests/testData.h"
 #include <gtest/gtest.h>
 #include <vector>
@@ -12,6 +17,35 @@ class MDModuleTest : public ::testing::Test
 {
     protected:
     DissolveSystemTest systemTest;
+
+    // Set up benzene system for constant energy dynamics over a fixed timestep
+    static void setUpNVE(DissolveSystemTest &test, int nSteps, double deltaT)
+    {
+        test.setUp("dissolve/input/md-benzene.txt");
+        test.loadRestart("dissolve/input/md-benzene.8.reference.restart");
+        test.setModuleEnabled("Forces01", false);
+
+        // A Berendsen thermostat with a vast time constant leaves velocities effectively unscaled
+        auto *md = test.getModule<MDModule>("MD01");
+        md->keywords().setEnumeration("Timestep", MDModule::TimestepType::Fixed);
+        md->keywords().set("DeltaT", deltaT);
+        md->keywords().set("NSteps", nSteps);
+        md->keywords().setEnumeration("Thermostat", MDModule::ThermostatType::Berendsen);
+        md->keywords().set("ThermostatTimeConstant", 1.0e9);
+    }
+    // Return total (kinetic plus potential) energy of the benzene system, in kJ/mol
+    static double totalEnergy(DissolveSystemTest &test)
+    {
+        auto *cfg = test.coreData().configuration(0);
+        const auto &velocities =
+            test.dissolve().processingModuleData().retrieve<std::vector<Vec3<double>>>("Bulk//Velocities", "MD01");
+        auto ke = 0.0;
+        for (const auto &i : cfg->atoms())
+            ke += 0.5 * AtomicMass::mass(i.speciesAtom()->Z()) * velocities[i.globalIndex()].magnitudeSq();
+
+        // Kinetic energy is in 10 J/mol
+        return ke * 0.01 + EnergyModule::totalEnergy(test.dissolve().worldPool(), cfg, test.dissolve().potentialMap());
+    }
 };
 
 TEST_F(MDModuleTest, BenzeneRestart)
@@ -24,4 +58,68 @@ TEST_F(MDModuleTest, BenzeneRestart)
                                {"dissolve/input/md-benzene.10.forces", ForceImportFileFormat::ForceImportFormat::Simple},
                                1.0e-4);
 }
+
+TEST_F(MDModuleTest, ThermostatScaling)
+{
+    auto xi = 0.0;
+
+    // Berendsen coupling with a time constant shorter than the timestep must not exceed a full rescale
+    EXPECT_NEAR(MDModule::thermostatScaling(MDModule::ThermostatType::Berendsen, 0.001, 1.0e-5, 300.0, 1200.0, xi), 0.5,
+                1.0e-12);
+    EXPECT_NEAR(MDModule::thermostatScaling(MDModule::ThermostatType::Berendsen, 0.001, 0.1, 300.0, 300.0, xi), 1.0, 1.0e-12);
+
+    // Nose-Hoover propagation is time-reversible - reversing the timestep from the scaled state recovers the original
+    // friction coefficient and temperature
+    xi = 0.3;
+    auto tInstant = 350.0;
+    auto scale = MDModule::thermostatScaling(MDModule::ThermostatType::NoseHoover, 0.001, 0.1, 300.0, tInstant, xi);
+    EXPECT_LT(scale, 1.0);
+    auto unscale = MDModule::thermostatScaling(MDModule::ThermostatType::NoseHoover, -0.001, 0.1, 300.0,
+                                               tInstant * scale * scale, xi);
+    EXPECT_NEAR(scale * unscale, 1.0, 1.0e-12);
+    EXPECT_NEAR(xi, 0.3, 1.0e-12);
+}
+
+TEST_F(MDModuleTest, RESPASingleStep)
+{
+    // Standard velocity Verlet integration
+    ASSERT_NO_THROW_VERBOSE(setUpNVE(systemTest, 10, 5.0e-4));
+    ASSERT_TRUE(systemTest.dissolve().iterate(1));
+    const auto &atoms = systemTest.coreData().configuration(0)->atoms();
+    const auto *box = systemTest.coreData().configuration(0)->box();
+
+    // A single inner step must reproduce it (to within differences in the order of summation between threads)
+    DissolveSystemTest singleTest;
+    ASSERT_NO_THROW_VERBOSE(setUpNVE(singleTest, 10, 5.0e-4));
+    singleTest.getModule<MDModule>("MD01")->keywords().set("RESPASteps", 1);
+    ASSERT_TRUE(singleTest.dissolve().iterate(1));
+    const auto &singleAtoms = singleTest.coreData().configuration(0)->atoms();
+    ASSERT_EQ(atoms.size(), singleAtoms.size());
+    for (auto n = 0; n < atoms.size(); ++n)
+        EXPECT_LT(box->minimumDistance(atoms[n].r(), singleAtoms[n].r()), 1.0e-8);
+
+    // Splitting the bound forces over two inner steps must stay close to the same trajectory over a short run
+    DissolveSystemTest respaTest;
+    ASSERT_NO_THROW_VERBOSE(setUpNVE(respaTest, 10, 5.0e-4));
+    respaTest.getModule<MDModule>("MD01")->keywords().set("RESPASteps", 2);
+    ASSERT_TRUE(respaTest.dissolve().iterate(1));
+    const auto &respaAtoms = respaTest.coreData().configuration(0)->atoms();
+    for (auto n = 0; n < atoms.size(); ++n)
+        EXPECT_LT(box->minimumDistance(atoms[n].r(), respaAtoms[n].r()), 1.0e-3);
+}
+
+TEST_F(MDModuleTest, RESPAEnergyDrift)
+{
+    // Four inner steps of 0.5 fs over the bound forces allow an outer timestep of 2 fs while conserving energy
+    ASSERT_NO_THROW_VERBOSE(setUpNVE(systemTest, 10, 2.0e-3));
+    systemTest.getModule<MDModule>("MD01")->keywords().set("RESPASteps", 4);
+    ASSERT_TRUE(systemTest.dissolve().iterate(1));
+    auto e0 = totalEnergy(systemTest);
+    ASSERT_TRUE(systemTest.dissolve().iterate(5));
+    auto e1 = totalEnergy(systemTest);
+
+    // Allow a drift of no more than 0.1 kJ/mol per molecule over the following 100 fs
+    EXPECT_NEAR(e1, e0, 0.1 * systemTest.coreData().configuration(0)->nMolecules());
+}
+
 } // namespace UnitTest
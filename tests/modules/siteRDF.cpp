@@ -40,6 +40,36 @@ TEST_F(SiteRDFModuleTest, Water)
     EXPECT_TRUE(systemTest.checkSampledDouble("coordination number B", "RDF(COM-COM)//CN//B", 19.413049, 3.0e-2));
 }
 
+TEST_F(SiteRDFModuleTest, WaterBatched)
+{
+    // Read the trajectory one frame per iteration
+    ASSERT_NO_THROW_VERBOSE(systemTest.setUp("dissolve/input/siteRDF-water.txt"));
+    ASSERT_TRUE(systemTest.dissolve().iterate(95));
+
+    // Read the same trajectory five frames per iteration
+    DissolveSystemTest batchedTest;
+    ASSERT_NO_THROW_VERBOSE(batchedTest.setUp("dissolve/input/siteRDF-water.txt",
+                                              [](Dissolve &D, CoreData &C)
+                                              { C.findModule("ImportTrajectory01")->keywords().set("NFrames", 5); }));
+    ASSERT_TRUE(batchedTest.dissolve().iterate(19));
+
+    // Batched results should match sequential ones
+    auto &sequentialData = systemTest.dissolve().processingModuleData();
+    auto &batchedData = batchedTest.dissolve().processingModuleData();
+    for (auto rdfName : {"RDF(OW-OW)", "RDF(H1-H2)", "RDF(COM-COM)"})
+    {
+        auto tag = fmt::format("{}//RDF", rdfName);
+        EXPECT_TRUE(DissolveSystemTest::checkData1D(sequentialData.retrieve<Data1D>(tag), tag,
+                                                    batchedData.retrieve<Data1D>(tag), tag, 1.0e-8));
+    }
+    for (auto range : {"A", "B"})
+    {
+        auto tag = fmt::format("RDF(COM-COM)//CN//{}", range);
+        EXPECT_TRUE(DissolveSystemTest::checkDouble(tag, sequentialData.retrieve<SampledDouble>(tag).value(),
+                                                    batchedData.retrieve<SampledDouble>(tag).value(), 1.0e-8));
+    }
+}
+
 TEST_F(SiteRDFModuleTest, WaterNPT)
 {
     ASSERT_NO_THROW_VERBOSE(systemTest.setUp("dissolve/input/siteRDF-waterNPT.txt"));
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// Copyright (c) 2024 Team Dissolve and contributors
+
+#include "base/processPool.h"
+#include <gtest/gtest.h>
+
+// Run all tests over the processes of the parallel job - the result is a failure if any process reports one
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    if (!ProcessPool::initialiseMPI(&argc, &argv))
+        return 1;
+
+    auto result = RUN_ALL_TESTS();
+
+    ProcessPool::finalise();
+
+    return result;
+}
@@ -193,4 +193,27 @@ TEST_F(PairPotentialsScaleFactorsTest, MoleculeEnergyWithSpeciesCharges)
                          fourSixthsBenzene_.atom(0).charge() * fourSixthsBenzene_.atom(3).charge());
 }
 
+TEST_F(PairPotentialsScaleFactorsTest, AdditionalPotential)
+{
+    setUpPotentials(true);
+
+    auto &i = molecule_.localAtoms()[0];
+    auto &j = molecule_.localAtoms()[3];
+    auto r = (j.r() - i.r()).magnitude();
+
+    // Apply a constant additional potential to the C1-C1 interaction
+    auto *pp11 = std::get<2>(pairPotentials_.front()).get();
+    auto version = pp11->tableVersion();
+    auto additional = pp11->additionalPotential();
+    std::fill(additional.values().begin(), additional.values().end(), 1.0);
+    pp11->setAdditionalPotential(additional);
+    EXPECT_NE(pp11->tableVersion(), version);
+
+    // The packed tables must pick up the change once updated
+    potentialMap_.updatePackedPotentials();
+    EXPECT_NEAR(potentialMap_.energy(i, j, r), referenceEnergy(r, atC1_->charge() * atC1_->charge()) + 1.0, testTolerance_);
+    EXPECT_NEAR(potentialMap_.energy(i, j, r), pp11->energy(r), testTolerance_);
+    EXPECT_NEAR(potentialMap_.force(i, j, r), referenceForce(r, atC1_->charge() * atC1_->charge()), testTolerance_);
+}
+
 } // namespace UnitTest